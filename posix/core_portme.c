@@ -0,0 +1,606 @@
+/*
+Copyright 2018 Embedded Microprocessor Benchmark Consortium (EEMBC)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Original Author: Shay Gal-on
+*/
+
+/**
+ * @file      core_portme.c
+ *
+ * @brief Coremark port for POSIX hosts, used to compare against the RP2
+ */
+
+#define _GNU_SOURCE
+#include "coremark.h"
+#include "core_portme.h"
+#include "core_timebase.h"
+#include "core_baseline.h"
+#include "core_clock.h"
+#include "core_log.h"
+#include "core_record.h"
+#include "core_shmoo.h"
+#include "core_telemetry.h"
+#include "core_thermal.h"
+#include "core_tune.h"
+#include <math.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Porting : Timing functions
+        The RP2 counts a 1MHz reference with a 32 bit PIO counter. Here the
+   same counter is simulated from CLOCK_MONOTONIC, starting at
+   HOST_COUNTER_START, and extended through the same <core_timebase>.
+*/
+static core_timebase   timebase = CORE_TIMEBASE_INIT;
+static pthread_mutex_t timebase_lock = PTHREAD_MUTEX_INITIALIZER;
+static ee_u64          counter_origin_us;
+
+static ee_u64
+monotonic_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ee_u64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+ee_u32
+barebones_clock_raw(void)
+{
+    return (ee_u32)(monotonic_us() - counter_origin_us + HOST_COUNTER_START);
+}
+
+CORETIMETYPE
+barebones_clock(void)
+{
+    CORETIMETYPE t;
+    pthread_mutex_lock(&timebase_lock);
+    t = core_timebase_extend(&timebase, barebones_clock_raw());
+    pthread_mutex_unlock(&timebase_lock);
+    return t;
+}
+
+#define EE_TICKS_PER_SEC 1000000.0
+static CORETIMETYPE start_time_val, stop_time_val;
+
+void
+start_time(void)
+{
+    start_time_val = barebones_clock();
+}
+
+void
+stop_time(void)
+{
+    stop_time_val = barebones_clock();
+}
+
+CORE_TICKS
+get_time(void)
+{
+    return stop_time_val - start_time_val;
+}
+
+secs_ret
+time_in_secs(CORE_TICKS ticks)
+{
+    return ((secs_ret)ticks) / (secs_ret)EE_TICKS_PER_SEC;
+}
+
+ee_u32 default_num_contexts = 1;
+ee_u32 scaling_sweep        = 1;
+ee_u32 data_size_sweep      = DATA_SIZE_SWEEP_MAX;
+
+/* Function : read_onboard_temperature
+        First thermal zone of the host, or NaN if it cannot be read, so a
+   host without one reports no temperature rather than 0 C.
+*/
+float
+read_onboard_temperature(void)
+{
+    FILE *f = fopen("/sys/class/thermal/thermal_zone0/temp", "r");
+    long  millic;
+    int   n;
+
+    if (f == NULL)
+        return NAN;
+    n = fscanf(f, "%ld", &millic);
+    fclose(f);
+    return n == 1 ? millic / 1000.0f : NAN;
+}
+
+#if CORE_LOG
+/* Porting : Console
+        <ee_printf> formats with vsnprintf into the console ring, and a
+   detached thread drains it to stdout, so the order of lines and the
+   dropped count behave as on the RP2. Whatever is left is flushed at exit.
+*/
+int
+ee_printf(const char *fmt, ...)
+{
+    char    buf[1024];
+    va_list args;
+    int     n;
+
+    va_start(args, fmt);
+    n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n > (int)sizeof(buf) - 1)
+        n = sizeof(buf) - 1;
+    if (n > 0)
+        core_log_write(buf, (ee_u32)n);
+    return n;
+}
+
+static void *
+log_drain(void *arg)
+{
+    const char *piece;
+    ee_u32      len;
+
+    (void)arg;
+    for (;;)
+    {
+        while ((len = core_log_next(&piece)) != 0)
+        {
+            fwrite(piece, 1, len, stdout);
+            core_log_done(len);
+        }
+        fflush(stdout);
+        usleep(1000);
+    }
+    return NULL;
+}
+
+/* The drain thread polls, so there is nothing to wake */
+void
+portable_log_kick(void)
+{
+}
+
+static void
+log_start(void)
+{
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, log_drain, NULL) == 0)
+    {
+        pthread_detach(thread);
+        atexit(core_log_flush);
+    }
+}
+#endif
+
+/* Porting : Temperature sampler
+        A detached thread, which the scheduler places wherever the contexts
+   are not, reads the thermal zone every THERMAL_PERIOD_MS.
+*/
+static atomic_int thermal_on;
+
+static void *
+thermal_sampler(void *arg)
+{
+    (void)arg;
+    float temp;
+
+    for (;;)
+    {
+        usleep(THERMAL_PERIOD_MS * 1000);
+        if (!atomic_load(&thermal_on))
+            continue;
+        temp = read_onboard_temperature();
+        if (TEMP_KNOWN(temp))
+            core_thermal_sample((ee_s32)(temp * 10.0f));
+    }
+    return NULL;
+}
+
+void
+portable_thermal_enable(ee_u32 on)
+{
+    static pthread_t thread;
+
+    if (on && !thread && pthread_create(&thread, NULL, thermal_sampler, NULL) == 0)
+        pthread_detach(thread);
+    atomic_store(&thermal_on, on != 0);
+}
+
+/* Function : portable_clock_info
+        The host clock is not requested, and is measured only as far as the
+   kernel reports it for the first CPU.
+*/
+void
+portable_clock_info(ee_u32 *requested_khz, ee_u32 *measured_khz, ee_s32 *vsel)
+{
+    FILE  *f = fopen("/proc/cpuinfo", "r");
+    char   line[256];
+    double mhz;
+
+    *requested_khz = 0;
+    *measured_khz  = 0;
+    *vsel          = -1;
+    if (f == NULL)
+        return;
+    while (fgets(line, sizeof(line), f))
+        if (sscanf(line, "cpu MHz : %lf", &mhz) == 1)
+        {
+            *measured_khz = (ee_u32)(mhz * 1000);
+            break;
+        }
+    fclose(f);
+}
+
+/* Porting : Simulated tuning device
+        With -t<MHz>, <portable_init> runs <core_tune_search>, or with
+   -g<MHz> the <core_shmoo_run> grid, against a
+   device that fails validation above that clock at its first level, and
+   TUNE_SIM_LEVEL_MHZ higher at each level after. TUNE_SIM_HANG_MHZ above
+   where it starts failing it hangs instead, and "reboots" back into the
+   search from the saved state, as the watchdog does on the RP2. The runs
+   themselves are real, only the failures are simulated.
+*/
+#define TUNE_SIM_LEVEL_MHZ 50
+#define TUNE_SIM_HANG_MHZ  60
+
+static const core_tune_level tune_levels[] = {
+    { 0, 1100 }, { 1, 1200 }, { 2, 1300 }
+};
+#define TUNE_NUM_LEVELS (sizeof(tune_levels) / sizeof(tune_levels[0]))
+
+static ee_u32  tune_sim_mhz;  /* Set by -t or -g, 0 for no search */
+static ee_u32  tune_sim_grid; /* Set by -g */
+static ee_u32  tune_sim_vsel, tune_sim_clock;
+static ee_u32  tune_sim_scratch[TUNE_WORDS];
+static jmp_buf tune_sim_reboot;
+
+ee_u32
+portable_tune_set(ee_u32 vsel, ee_u32 mhz)
+{
+    tune_sim_vsel  = vsel;
+    tune_sim_clock = mhz;
+    return 1;
+}
+
+ee_u32
+portable_tune_run(ee_u32 iterations)
+{
+    ee_u32 limit = tune_sim_mhz + tune_sim_vsel * TUNE_SIM_LEVEL_MHZ, kind;
+
+    if (tune_sim_clock > limit + TUNE_SIM_HANG_MHZ)
+        longjmp(tune_sim_reboot, 1);
+    kind = core_tune_check(iterations);
+    return tune_sim_clock > limit ? ID_MATRIX : kind;
+}
+
+void
+portable_tune_save(const ee_u32 *words)
+{
+    memcpy(tune_sim_scratch, words, sizeof(tune_sim_scratch));
+}
+
+ee_u32
+portable_tune_load(ee_u32 *words)
+{
+    memcpy(words, tune_sim_scratch, sizeof(tune_sim_scratch));
+    return (words[0] >> 24) == TUNE_MAGIC;
+}
+
+/* Function : portable_chip_id
+        The host name stands in for the unique ID of a board.
+*/
+void
+portable_chip_id(char *id, ee_u32 size)
+{
+    if (gethostname(id, size) != 0)
+        strncpy(id, "host", size);
+    id[size - 1] = 0;
+}
+
+/* Function : shmoo_simulated
+        Run the grid to the end, through the simulated reboots.
+*/
+static void
+shmoo_simulated(void)
+{
+    ee_u32 words[TUNE_WORDS] = { 0 };
+
+    portable_tune_save(words);
+    if (setjmp(tune_sim_reboot))
+    {
+        portable_tune_load(words);
+        core_shmoo_run(tune_levels, TUNE_NUM_LEVELS, words);
+    }
+    else
+        core_shmoo_run(tune_levels, TUNE_NUM_LEVELS, NULL);
+}
+
+/* Function : tune_simulated
+        Run the search to the end, through as many simulated reboots as it
+   takes, and print the table.
+*/
+static void
+tune_simulated(void)
+{
+    static core_tune t;
+    ee_u32           words[TUNE_WORDS];
+
+    core_tune_start(&t);
+    core_tune_pack(&t, words);
+    portable_tune_save(words);
+    if (setjmp(tune_sim_reboot))
+        ee_printf("Tune           : simulated hang, rebooting\n");
+    portable_tune_load(words);
+    core_tune_unpack(&t, words);
+    core_tune_search(&t, tune_levels, TUNE_NUM_LEVELS);
+    core_tune_report(&t, tune_levels, TUNE_NUM_LEVELS);
+}
+
+static const char *baseline_path = "coremark.baseline"; /* Set by -f */
+
+/* Function : portable_baseline_load
+        Read the baseline file, one word in hex per line.
+*/
+ee_u32
+portable_baseline_load(ee_u32 *words)
+{
+    FILE         *f = fopen(baseline_path, "r");
+    unsigned long w;
+    ee_u32        i;
+
+    if (f == NULL)
+        return 0;
+    for (i = 0; i < BASELINE_WORDS && fscanf(f, "%lx", &w) == 1; i++)
+        words[i] = (ee_u32)w;
+    fclose(f);
+    return i == BASELINE_WORDS;
+}
+
+/* Function : portable_baseline_save
+        Write the baseline file.
+*/
+void
+portable_baseline_save(const ee_u32 *words)
+{
+    FILE  *f = fopen(baseline_path, "w");
+    ee_u32 i;
+
+    if (f == NULL)
+    {
+        ee_printf("Baseline         : cannot write %s\n", baseline_path);
+        return;
+    }
+    for (i = 0; i < BASELINE_WORDS; i++)
+        fprintf(f, "%08lx\n", (unsigned long)words[i]);
+    fclose(f);
+}
+
+/* Function : portable_clock_sample
+        There is no cycle counter of the host's own to read.
+*/
+void
+portable_clock_sample(void)
+{
+}
+
+/* Function : clock_trace
+        Replay a trace of raw counter pairs, the reference then the cycles
+   on each line, through the clock measurement, and print each interval and
+   the clock.
+*/
+static void
+clock_trace(const char *path)
+{
+    static core_clock c;
+    FILE             *f         = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    char              ref[32], cycles[32];
+    ee_u32            intervals = 0;
+
+    if (f == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+    core_clock_reset(&c);
+    ee_printf("clock,ref,khz\n");
+    while (fscanf(f, "%31s %31s", ref, cycles) == 2)
+    {
+        core_clock_add(&c, (ee_u32)strtoul(ref, NULL, 0), (ee_u32)strtoul(cycles, NULL, 0));
+        if (c.intervals != intervals)
+        {
+            intervals = c.intervals;
+            ee_printf("clock,%s,%lu\n", ref, (unsigned long)c.last_khz);
+        }
+    }
+    if (f != stdin)
+        fclose(f);
+    core_clock_print(&c);
+}
+
+/* Function : portable_init
+        Target specific initialization code
+
+        Options are taken out of argv so the seeds stay positional:
+        -c<N> - run N contexts instead of one per online CPU.
+        -s    - do not run the 1..N context scaling sweep.
+        -m<B> - run the data size sweep up to B bytes per context.
+        -t<M> - run the clock search against a simulated device that fails
+                above M MHz, print the table and exit.
+        -g<M> - run the shmoo grid against the same device and exit.
+        -l<C> - thermal limit in degrees C.
+        -p    - hold the contexts at the thermal limit instead of aborting.
+        -b    - also send binary telemetry frames on stdout.
+        -k<F> - replay the counter trace in file F through the clock
+                measurement, print it and exit.
+        -f<F> - keep baselines in file F instead of coremark.baseline.
+        -K    - store the first valid pass as the baseline for its number
+                of contexts.
+*/
+void
+portable_init(core_portable *p, int *argc, char *argv[])
+{
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    int  i, out = 1;
+
+#if CORE_LOG
+    log_start();
+#endif
+    counter_origin_us    = monotonic_us();
+    default_num_contexts = ncpu > 0 ? (ee_u32)ncpu : 1;
+
+    for (i = 1; i < *argc; i++)
+    {
+        if (argv[i][0] == '-' && argv[i][1] == 'c')
+            default_num_contexts = (ee_u32)atoi(argv[i] + 2);
+        else if (strcmp(argv[i], "-s") == 0)
+            scaling_sweep = 0;
+        else if (argv[i][0] == '-' && argv[i][1] == 'm')
+            data_size_sweep = (ee_u32)strtoul(argv[i] + 2, NULL, 0);
+        else if (argv[i][0] == '-' && argv[i][1] == 't')
+            tune_sim_mhz = (ee_u32)atoi(argv[i] + 2);
+        else if (argv[i][0] == '-' && argv[i][1] == 'g')
+        {
+            tune_sim_mhz  = (ee_u32)atoi(argv[i] + 2);
+            tune_sim_grid = 1;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] == 'l')
+            thermal_limit10 = (ee_s32)(atof(argv[i] + 2) * 10);
+        else if (strcmp(argv[i], "-p") == 0)
+            thermal_hold = 1;
+        else if (strcmp(argv[i], "-o") == 0)
+            thermal_overhead = 1;
+        else if (argv[i][0] == '-' && argv[i][1] == 'f')
+            baseline_path = argv[i] + 2;
+        else if (strcmp(argv[i], "-K") == 0)
+            baseline_calibrate = 1;
+        else if (argv[i][0] == '-' && argv[i][1] == 'k')
+        {
+            clock_trace(argv[i] + 2);
+            exit(0);
+        }
+#if CORE_TELEMETRY
+        else if (strcmp(argv[i], "-b") == 0)
+            telemetry_on = 1;
+#endif
+        else
+            argv[out++] = argv[i];
+    }
+    *argc = out;
+
+    if (tune_sim_mhz)
+    {
+        if (tune_sim_grid)
+            shmoo_simulated();
+        else
+            tune_simulated();
+        exit(0);
+    }
+    portable_thermal_enable(1);
+
+    if (sizeof(ee_ptr_int) != sizeof(ee_u8 *))
+    {
+        ee_printf(
+            "ERROR! Please define ee_ptr_int to a type that holds a "
+            "pointer!\n");
+    }
+    if (sizeof(ee_u32) != 4)
+    {
+        ee_printf("ERROR! Please define ee_u32 to a 32b unsigned type!\n");
+    }
+    p->portable_id = 1;
+}
+
+/* Function : portable_fini
+        Target specific final code
+*/
+void
+portable_fini(core_portable *p)
+{
+    p->portable_id = 0;
+}
+
+/* Function : portable_safe_clock
+        The host clock is not under our control, so references are computed
+   at whatever it runs at.
+*/
+void
+portable_safe_clock(ee_u32 safe)
+{
+    (void)safe;
+}
+
+/* Parallel contexts
+        Each context runs on its own pthread, pinned to CPU (index % ncpu).
+   Threads wait at a start barrier which <core_end_parallel> releases once
+   every thread started is ready, so thread creation is not timed.
+*/
+static pthread_t   threads[MULTITHREAD];
+static atomic_uint threads_started;
+static atomic_uint threads_ready;
+static atomic_int  threads_go;
+
+static void *
+context_thread(void *pres)
+{
+    atomic_fetch_add(&threads_ready, 1);
+    while (!atomic_load(&threads_go))
+        sched_yield();
+    return iterate(pres);
+}
+
+void
+core_start_parallel(ee_u16 core_index, core_results *res)
+{
+    long           ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_attr_t attr;
+    cpu_set_t      cpus;
+
+    if (core_index == 0)
+    {
+        atomic_store(&threads_started, 0);
+        atomic_store(&threads_ready, 0);
+        atomic_store(&threads_go, 0);
+    }
+    pthread_attr_init(&attr);
+    if (ncpu > 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(core_index % ncpu, &cpus);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+    }
+    if (pthread_create(&threads[core_index], &attr, context_thread, res) != 0)
+    {
+        ee_printf("ERROR! Cannot start context %u\n", core_index);
+        exit(1);
+    }
+    pthread_attr_destroy(&attr);
+    atomic_fetch_add(&threads_started, 1);
+}
+
+void
+core_end_parallel(ee_u16 core_index)
+{
+    if (!atomic_load(&threads_go))
+    {
+        while (atomic_load(&threads_ready) < atomic_load(&threads_started))
+            sched_yield();
+        atomic_store(&threads_go, 1);
+    }
+    pthread_join(threads[core_index], NULL);
+}
@@ -0,0 +1,238 @@
+/*
+Copyright 2018 Embedded Microprocessor Benchmark Consortium (EEMBC)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Original Author: Shay Gal-on
+*/
+
+/**
+ * @file      core_portme.h
+ *
+ * @brief Coremark port for POSIX hosts, used to compare against the RP2
+ */
+
+/* Topic : Description
+        This file contains configuration constants required to execute on
+   a POSIX host with pthreads. The harness is the same as on the RP2, with
+   the reference clock simulated from the monotonic clock.
+*/
+#ifndef CORE_PORTME_H
+#define CORE_PORTME_H
+
+/************************/
+/* Data types and settings */
+/************************/
+#ifndef HAS_FLOAT
+#define HAS_FLOAT 1
+#endif
+#ifndef HAS_TIME_H
+#define HAS_TIME_H 1
+#endif
+#ifndef USE_CLOCK
+#define USE_CLOCK 0
+#endif
+#ifndef HAS_STDIO
+#define HAS_STDIO 1
+#endif
+/* Configuration : CORE_LOG
+        ee_printf goes through the same console ring as on the RP2, drained
+   to stdout by a thread, see <core_log.h>.
+*/
+#ifndef CORE_LOG
+#define CORE_LOG 1
+#endif
+#ifndef HAS_PRINTF
+#define HAS_PRINTF (!CORE_LOG)
+#endif
+/* Configuration : CORE_TELEMETRY
+        -b sends binary telemetry frames on stdout, see <core_telemetry.h>.
+*/
+#ifndef CORE_TELEMETRY
+#define CORE_TELEMETRY CORE_LOG
+#endif
+
+/* Definitions : COMPILER_VERSION, COMPILER_FLAGS, MEM_LOCATION
+        Initialize these strings per platform
+*/
+#ifndef COMPILER_VERSION
+#ifdef __GNUC__
+        #define COMPILER_VERSION "GCC"__VERSION__
+#else
+        #define COMPILER_VERSION "Please put compiler version here (e.g. gcc 4.1)"
+#endif
+#endif
+#ifndef COMPILER_FLAGS
+        #define COMPILER_FLAGS "O3"
+#endif
+#ifndef MEM_LOCATION
+        #define MEM_LOCATION "HEAP"
+#endif
+
+/* Libs: Default library includes for datatypes
+        Include default libs required for program run here.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* Data Types :
+        ee_ptr_int needs to be the data type used to hold pointers.
+*/
+typedef int16_t   ee_s16;
+typedef uint16_t  ee_u16;
+typedef int32_t   ee_s32;
+typedef float     ee_f32;
+typedef uint8_t   ee_u8;
+typedef uint32_t  ee_u32;
+typedef uint64_t  ee_u64;
+typedef uintptr_t ee_ptr_int;
+typedef size_t    ee_size_t;
+/* align_mem :
+        This macro is used to align an offset to point to a 32b value. It is
+   used in the Matrix algorithm to initialize the input memory blocks.
+*/
+#define align_mem(x) (void *)(4 + (((ee_ptr_int)(x)-1) & ~3))
+
+/* Configuration : CORE_TICKS
+        Define type of return from the timing functions.
+
+        As on the RP2, a 32 bit counter is extended to 64 bits by
+   <core_timebase.h>. The counter is simulated in microseconds from the
+   monotonic clock, offset by HOST_COUNTER_START so that it wraps early in
+   every run and the wrap handling is exercised.
+ */
+#define CORETIMETYPE ee_u64
+typedef CORETIMETYPE CORE_TICKS;
+
+#ifndef HOST_COUNTER_START
+#define HOST_COUNTER_START 0xffe17b80u /* wraps 2 seconds after start */
+#endif
+
+CORETIMETYPE barebones_clock(void);
+ee_u32       barebones_clock_raw(void);
+
+/* Configuration : SEED_METHOD
+        Seeds come from the command line, as in the reference POSIX port.
+*/
+#ifndef SEED_METHOD
+#define SEED_METHOD SEED_ARG
+#endif
+
+/* Configuration : MEM_METHOD
+        Defines method to get a block of memry.
+*/
+#ifndef MEM_METHOD
+#define MEM_METHOD MEM_MALLOC
+#endif
+
+#define portable_malloc malloc
+#define portable_free free
+
+/* Configuration : CORE_CLOCK_MEASURE
+        The host has no cycle counter to read, but -k replays traces of
+   counter pairs through <core_clock.h>.
+*/
+#ifndef CORE_CLOCK_MEASURE
+#define CORE_CLOCK_MEASURE 1
+#endif
+
+/* Configuration : BASELINE_STORE_NAME
+        Baselines are kept in a file, coremark.baseline unless -f names
+   another, see <core_baseline.h>.
+*/
+#ifndef BASELINE_STORE_NAME
+#define BASELINE_STORE_NAME "file"
+#endif
+
+/* Configuration : CORE_THERMAL
+        A thread samples the host thermal zone during the timed run, see
+   <core_thermal.h>.
+*/
+#ifndef CORE_THERMAL
+#define CORE_THERMAL 1
+#endif
+
+/* Configuration : MULTITHREAD
+        Upper bound on the number of contexts. The number run is picked at run
+   time, by default one per online CPU, and each context runs on a pthread
+   pinned to its own CPU.
+*/
+#ifndef MULTITHREAD
+#define MULTITHREAD 64
+#define USE_PTHREAD 1
+#define USE_FORK    0
+#define USE_SOCKET  0
+#endif
+
+#ifndef MAIN_HAS_NOARGC
+#define MAIN_HAS_NOARGC 0
+#endif
+#ifndef MAIN_HAS_NORETURN
+#define MAIN_HAS_NORETURN 0
+#endif
+
+/* Variable : default_num_contexts
+        Number of contexts to run, set by <portable_init> from the -c option
+   or the number of online CPUs, and clamped to 1..MULTITHREAD.
+*/
+extern ee_u32 default_num_contexts;
+
+/* Variable : scaling_sweep
+        When non zero, every pass also runs 1..default_num_contexts contexts
+   and reports the scaling efficiency of each against a single context. On by
+   default, -s turns it off.
+*/
+extern ee_u32 scaling_sweep;
+
+/* Variable : data_size_sweep
+        Largest memory block, in bytes per context, of the data size sweep
+   run on every pass, or 0 for no sweep. Defaults to DATA_SIZE_SWEEP_MAX, -m<bytes>
+   sets it.
+*/
+extern ee_u32 data_size_sweep;
+
+typedef struct CORE_PORTABLE_S
+{
+    ee_u8 portable_id;
+} core_portable;
+
+/* target specific init/fini */
+void portable_init(core_portable *p, int *argc, char *argv[]);
+void portable_fini(core_portable *p);
+
+/* Run at a known good clock when safe is non zero, a no-op on the host */
+void portable_safe_clock(ee_u32 safe);
+
+/* Host thermal zone 0 in degrees C, NaN when there is none */
+float read_onboard_temperature(void);
+
+#define PARALLEL_METHOD "PThreads"
+
+#if !defined(PROFILE_RUN) && !defined(PERFORMANCE_RUN) \
+    && !defined(VALIDATION_RUN)
+#if (TOTAL_DATA_SIZE == 1200)
+#define PROFILE_RUN 1
+#elif (TOTAL_DATA_SIZE == 2000)
+#define PERFORMANCE_RUN 1
+#else
+#define VALIDATION_RUN 1
+#endif
+#endif
+
+#if !HAS_PRINTF
+int ee_printf(const char *fmt, ...);
+#endif
+
+#endif /* CORE_PORTME_H */
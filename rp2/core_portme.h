@@ -62,10 +62,11 @@ Original Author: Shay Gal-on
 #endif
 /* Configuration : HAS_PRINTF
         Define to 1 if the platform has stdio.h and implements the printf
-   function.
+   function. Off with CORE_LOG, so <ee_printf> writes into the console
+   ring rather than straight to the UART behind the DMA.
 */
 #ifndef HAS_PRINTF
-#define HAS_PRINTF 1
+#define HAS_PRINTF (!CORE_LOG)
 #endif
 
 /* Definitions : COMPILER_VERSION, COMPILER_FLAGS, MEM_LOCATION
@@ -111,6 +112,7 @@ typedef int32_t   ee_s32;
 typedef float     ee_f32;
 typedef uint8_t   ee_u8;
 typedef uint32_t  ee_u32;
+typedef uint64_t  ee_u64;
 typedef ee_u32    ee_ptr_int;
 typedef uint32_t  ee_size_t;
 #define NULL ((void *)0)
@@ -122,11 +124,30 @@ typedef uint32_t  ee_size_t;
 
 /* Configuration : CORE_TICKS
         Define type of return from the timing functions.
+
+        The 32 bit reference clock counter is extended to 64 bits in software
+   (see <core_timebase.h>) so long runs do not wrap after ~71 minutes.
  */
-//#define CORETIMETYPE uint64_t
-#define CORETIMETYPE uint32_t
+#define CORETIMETYPE ee_u64
 typedef CORETIMETYPE CORE_TICKS;
 
+/* Timing : barebones_clock, barebones_clock_raw
+        <barebones_clock> returns the extended 64 bit reference clock.
+   <barebones_clock_raw> returns the raw 32 bit counter, which is cheap enough
+   to read in the hot path as long as the interval measured stays well below
+   the wrap period.
+*/
+CORETIMETYPE barebones_clock(void);
+ee_u32       barebones_clock_raw(void);
+
+/* Configuration : STRESS_LOOP
+        Define to 1 to repeat the whole benchmark forever, re-reading the
+   seeds on every pass, for stress testing overclocked parts.
+*/
+#ifndef STRESS_LOOP
+#define STRESS_LOOP 1
+#endif
+
 /* Configuration : SEED_METHOD
         Defines method to get seed values that cannot be computed at compile
    time.
@@ -155,12 +176,60 @@ typedef CORETIMETYPE CORE_TICKS;
 #define portable_malloc malloc
 #define portable_free free
 
+/* Configuration : MEM_STATIC_PLACEMENT
+        Where the per context arenas go when MEM_METHOD is MEM_STATIC, to
+   compare bus contention between layouts. Core 1 runs context 0, core 0 runs
+   context 1.
+
+        Valid values :
+        0 - both arenas in striped main SRAM (default).
+        1 - context 0 in scratch_x next to the core 1 stack, context 1 in
+   striped main SRAM.
+        2 - context 0 in scratch_x, context 1 in scratch_y next to the core 0
+   stack, so each core has a bank to itself.
+
+        Note :
+        The scratch banks are 4K and also hold a 2K stack, so TOTAL_DATA_SIZE
+   has to stay at the default 2000 for layouts 1 and 2, which is checked
+   at compile time.
+*/
+#ifndef MEM_STATIC_PLACEMENT
+#define MEM_STATIC_PLACEMENT 0
+#endif
+#if (MEM_STATIC_PLACEMENT != 0) && (MEM_METHOD != MEM_STATIC)
+#error "MEM_STATIC_PLACEMENT needs MEM_METHOD MEM_STATIC"
+#endif
+#if (MEM_STATIC_PLACEMENT < 0) || (MEM_STATIC_PLACEMENT > 2)
+#error "MEM_STATIC_PLACEMENT must be 0, 1 or 2"
+#endif
+/* Each scratch bank holds one arena, 8 byte aligned, beside the stack of a
+ * core: core 1 in scratch_x, core 0 in scratch_y */
+#define SCRATCH_BANK_BYTES 0x1000
+#ifdef PICO_STACK_SIZE
+#define SCRATCH_Y_STACK_BYTES PICO_STACK_SIZE
+#else
+#define SCRATCH_Y_STACK_BYTES 0x800
+#endif
+#if (MEM_STATIC_PLACEMENT >= 1)
+#if (TOTAL_DATA_SIZE + 8 > SCRATCH_BANK_BYTES - PICO_CORE1_STACK_SIZE)
+#error "The context 0 arena does not fit in scratch_x beside the core 1 stack"
+#endif
+#define STATIC_ARENA0_ATTR __scratch_x("coremark_arena")
+#endif
+#if (MEM_STATIC_PLACEMENT == 2)
+#if (TOTAL_DATA_SIZE + 8 > SCRATCH_BANK_BYTES - SCRATCH_Y_STACK_BYTES)
+#error "The context 1 arena does not fit in scratch_y beside the core 0 stack"
+#endif
+#define STATIC_ARENA1_ATTR __scratch_y("coremark_arena")
+#endif
+
 /* Configuration : MULTITHREAD
         Define for parallel execution
 
         Valid values :
         1 - only one context (default).
-        N>1 - will execute N copies in parallel.
+        N>1 - will execute up to N copies in parallel, the actual number is
+   picked at run time through <default_num_contexts>.
 
         Note :
         If this flag is defined to more then 1, an implementation for launching
@@ -206,10 +275,32 @@ typedef CORETIMETYPE CORE_TICKS;
 #endif
 
 /* Variable : default_num_contexts
-        Not used for this simple port, must cintain the value 1.
+        Number of contexts to run, chosen at run time by <portable_init>
+   and clamped to 1..MULTITHREAD.
 */
 extern ee_u32 default_num_contexts;
 
+/* Variable : scaling_sweep
+        When non zero, every pass also runs 1..default_num_contexts contexts
+   and reports the scaling efficiency of each against a single context.
+*/
+extern ee_u32 scaling_sweep;
+
+/* Variable : data_size_sweep
+        Largest memory block, in bytes per context, of the data size sweep
+   run on every pass, or 0 for no sweep. Defaults to DATA_SIZE_SWEEP_MAX,
+   and D at the start prompt asks for it.
+*/
+extern ee_u32 data_size_sweep;
+
+/* Configuration : DATA_SIZE_SWEEP_LIMIT
+        Largest block per context the sweep can be asked for, so that the
+   blocks of both cores fit in SRAM beside the program.
+*/
+#ifndef DATA_SIZE_SWEEP_LIMIT
+#define DATA_SIZE_SWEEP_LIMIT 128000
+#endif
+
 typedef struct CORE_PORTABLE_S
 {
     ee_u8 portable_id;
@@ -219,6 +310,102 @@ typedef struct CORE_PORTABLE_S
 void portable_init(core_portable *p, int *argc, char *argv[]);
 void portable_fini(core_portable *p);
 
+/* Configuration : DIAG_SAFE_MHZ
+        clk_sys, in MHz, that <portable_safe_clock> runs reference
+   computations at: the default clock, which needs no voltage change.
+*/
+#ifndef DIAG_SAFE_MHZ
+#define DIAG_SAFE_MHZ 150
+#endif
+
+/* Run at DIAG_SAFE_MHZ when safe is non zero, else at the clock of the run */
+void portable_safe_clock(ee_u32 safe);
+
+/* Configuration : TUNE_LEVELS
+        Voltage levels the T option searches, lowest first, as
+   { vreg setting, mV }. Settings with 0x10 set lift the regulator's voltage
+   limit, as in the voltage menu.
+*/
+#ifndef TUNE_LEVELS
+#define TUNE_LEVELS { { 11, 1100 }, { 13, 1200 }, { 15, 1300 } }
+#endif
+
+/* Configuration : TUNE_WATCHDOG_MS
+        Watchdog timeout while a clock is on trial, longer than one run of
+   TUNE_ITERATIONS at TUNE_MIN_MHZ.
+*/
+#ifndef TUNE_WATCHDOG_MS
+#define TUNE_WATCHDOG_MS 4000
+#endif
+
+/* Configuration : CORE_CRASH_RECORD
+        This port records hard faults and hangs across a reboot, see
+   <core_crash.h>.
+*/
+#ifndef CORE_CRASH_RECORD
+#define CORE_CRASH_RECORD 1
+#endif
+
+/* Configuration : CORE_LOG
+        ee_printf writes into a ring that DMA sends to the UART, see
+   <core_log.h>.
+*/
+#ifndef CORE_LOG
+#define CORE_LOG 1
+#endif
+
+/* Configuration : CORE_CLOCK_MEASURE
+        clk_sys is measured with the cycle counter against the 1MHz
+   reference, see <core_clock.h>.
+*/
+#ifndef CORE_CLOCK_MEASURE
+#define CORE_CLOCK_MEASURE 1
+#endif
+
+/* Configuration : BASELINE_STORE_NAME
+        Baselines are kept in the last sector of flash, see
+   <core_baseline.h>.
+*/
+#ifndef BASELINE_STORE_NAME
+#define BASELINE_STORE_NAME "flash"
+#endif
+
+/* Configuration : CORE_TELEMETRY
+        Starting with B instead of S also sends binary telemetry frames on
+   the UART, see <core_telemetry.h>.
+*/
+#ifndef CORE_TELEMETRY
+#define CORE_TELEMETRY 1
+#endif
+
+/* Configuration : CORE_THERMAL
+        The ADC samples the temperature sensor through DMA during the run,
+   see <core_thermal.h>.
+*/
+#ifndef CORE_THERMAL
+#define CORE_THERMAL 1
+#endif
+
+/* Configuration : CRASH_WATCHDOG_MS
+        Watchdog timeout during the run. The 500ms alarm feeds it, so it only
+   fires when core 0 stops taking interrupts.
+*/
+#ifndef CRASH_WATCHDOG_MS
+#define CRASH_WATCHDOG_MS 3000
+#endif
+
+/* Configuration : CRASH_STALL_CHECKS
+        Alarm ticks, of 500ms, that an iteration may take before its context
+   is recorded as hung. Longer than one iteration of the largest memory
+   block the data size sweep runs.
+*/
+#ifndef CRASH_STALL_CHECKS
+#define CRASH_STALL_CHECKS 8
+#endif
+
+/* On chip temperature sensor, in degrees C */
+float read_onboard_temperature(void);
+
 /* Custom core start code */
 #define PARALLEL_METHOD " Multicore"
 // extern struct RESULTS_S core_results;
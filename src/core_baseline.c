@@ -0,0 +1,248 @@
+/**
+ * @file      core_baseline.c
+ *
+ * @brief Calibrated CoreMark/MHz baseline and equivalent MHz
+ */
+
+#include "coremark.h"
+#include "core_baseline.h"
+
+ee_u32 baseline_calibrate;
+
+typedef struct CORE_BASELINE_BUILTIN_S
+{
+    ee_u32 contexts;
+    double mhz;
+    double score;
+} core_baseline_builtin;
+
+/* Variable : baseline_builtin
+        The baselines given at build time, ended by an entry of 0 contexts.
+*/
+static const core_baseline_builtin baseline_builtin[] = {
+#ifdef CORE_BASELINE_BUILTIN
+    CORE_BASELINE_BUILTIN,
+#endif
+    { 0, 0, 0 }
+};
+
+static ee_u32
+baseline_checksum(const ee_u32 *words)
+{
+    ee_u32 sum = 0xffffffff;
+    ee_u32 i;
+
+    for (i = 0; i < BASELINE_WORDS - 1; i++)
+        sum = ((sum << 5) | (sum >> 27)) ^ words[i];
+    return sum;
+}
+
+static ee_u16
+baseline_crc_string(const char *s, ee_u16 crc)
+{
+    while (*s)
+        crc = crcu8((ee_u8)*s++, crc);
+    return crcu8(0, crc);
+}
+
+/* Function : core_baseline_key
+        Returns:
+        A key of the compiler, flags, memory location and ISA of this build.
+*/
+ee_u32
+core_baseline_key(void)
+{
+    ee_u16 crc = 0;
+
+    crc = baseline_crc_string(COMPILER_VERSION, crc);
+    crc = baseline_crc_string(COMPILER_FLAGS, crc);
+    crc = baseline_crc_string(MEM_LOCATION, crc);
+    crc = baseline_crc_string(BASELINE_ISA, crc);
+    return crcu32(TOTAL_DATA_SIZE, crc);
+}
+
+/* Function : core_baseline_pack
+        Pack <b> into BASELINE_WORDS words, the last of which is a checksum
+   of the others.
+*/
+void
+core_baseline_pack(const core_baseline *b, ee_u32 *words)
+{
+    ee_u32 i;
+
+    words[0] = ((ee_u32)BASELINE_MAGIC << 16) | b->count;
+    words[1] = b->key;
+    for (i = 0; i < BASELINE_ENTRIES; i++)
+    {
+        words[2 + 2 * i] = i < b->count ? (b->entry[i].contexts << 24) | (b->entry[i].khz & 0xffffff) : 0;
+        words[3 + 2 * i] = i < b->count ? b->entry[i].per_mhz : 0;
+    }
+    words[BASELINE_WORDS - 1] = baseline_checksum(words);
+}
+
+/* Function : core_baseline_unpack
+        Returns:
+        Non zero when <words> hold a good store of this build, filling <b>.
+*/
+ee_u32
+core_baseline_unpack(core_baseline *b, const ee_u32 *words)
+{
+    ee_u32 i;
+
+    if ((words[0] >> 16) != BASELINE_MAGIC || (words[0] & 0xffff) > BASELINE_ENTRIES
+        || words[1] != core_baseline_key()
+        || words[BASELINE_WORDS - 1] != baseline_checksum(words))
+        return 0;
+    b->count = words[0] & 0xffff;
+    b->key   = words[1];
+    for (i = 0; i < b->count; i++)
+    {
+        b->entry[i].contexts = words[2 + 2 * i] >> 24;
+        b->entry[i].khz      = words[2 + 2 * i] & 0xffffff;
+        b->entry[i].per_mhz  = words[3 + 2 * i];
+    }
+    return 1;
+}
+
+/* Function : baseline_find
+        Fill the baseline of <e> from the one for <contexts>, stored or built
+   in, in that order.
+
+        Returns:
+        Non zero when there is one.
+*/
+static ee_u32
+baseline_find(core_baseline_eval *e, const core_baseline *stored, ee_u32 contexts)
+{
+    const core_baseline_builtin *bi;
+    ee_u32                       i;
+
+    for (i = 0; stored && i < stored->count; i++)
+        if (stored->entry[i].contexts == contexts)
+        {
+            e->baseline_mhz = stored->entry[i].per_mhz / (secs_ret)1000000;
+            e->khz          = stored->entry[i].khz;
+            e->source       = BASELINE_STORE_NAME;
+            break;
+        }
+    for (bi = baseline_builtin; e->baseline_mhz == 0 && bi->contexts; bi++)
+        if (bi->contexts == contexts && bi->mhz > 0)
+        {
+            e->baseline_mhz = (secs_ret)(bi->score / bi->mhz);
+            e->khz          = (ee_u32)(bi->mhz * 1000);
+            e->source       = "build";
+        }
+    e->contexts = contexts;
+    return e->baseline_mhz > 0;
+}
+
+/* Function : core_baseline_eval_run
+        Work out CoreMark/MHz, equivalent MHz and drift for a pass of
+   <contexts> that scored <score> at <measured_khz>, 0 when not measured.
+*/
+void
+core_baseline_eval_run(core_baseline_eval *e, secs_ret score, ee_u32 contexts, ee_u32 measured_khz)
+{
+    core_baseline  stored;
+    ee_u32         words[BASELINE_WORDS];
+    core_baseline *have = NULL;
+    secs_ret       measured_mhz = measured_khz / (secs_ret)1000;
+
+    e->score          = score;
+    e->coremark_mhz   = measured_mhz > 0 ? score / measured_mhz : 0;
+    e->baseline_mhz   = 0;
+    e->equivalent_mhz = 0;
+    e->drift_pct      = 0;
+    e->drifted        = 0;
+    e->scaled         = 0;
+    e->source         = "";
+    if (portable_baseline_load(words) && core_baseline_unpack(&stored, words))
+        have = &stored;
+    /* without a baseline of its own, contexts should scale linearly from
+     * one */
+    if (!baseline_find(e, have, contexts) && contexts > 1 && baseline_find(e, have, 1))
+    {
+        e->baseline_mhz *= contexts;
+        e->scaled = 1;
+    }
+    if (e->baseline_mhz == 0)
+        return;
+    e->equivalent_mhz = score / e->baseline_mhz;
+    if (measured_mhz > 0)
+    {
+        e->drift_pct = (e->equivalent_mhz / measured_mhz - 1) * 100;
+        e->drifted   = e->drift_pct > BASELINE_DRIFT_PCT || e->drift_pct < -BASELINE_DRIFT_PCT;
+    }
+}
+
+/* Function : core_baseline_report
+        Print the score, CoreMark/MHz and equivalent MHz of <e>, and flag a
+   drift from linear scaling.
+*/
+void
+core_baseline_report(const core_baseline_eval *e)
+{
+    ee_printf("CoreMark         : %f\n", (double)e->score);
+    if (e->coremark_mhz > 0)
+        ee_printf("CoreMark/MHz     : %f\n", (double)e->coremark_mhz);
+    if (e->baseline_mhz == 0)
+    {
+        ee_printf("Equivalent MHz   : no baseline for this build\n");
+        return;
+    }
+    ee_printf("Equivalent MHz   : %.3f (baseline %.4f CoreMark/MHz at %.3f MHz, %s%lu context%s, %s)\n",
+              (double)e->equivalent_mhz,
+              (double)e->baseline_mhz,
+              e->khz / 1000.0,
+              e->scaled ? "scaled from " : "",
+              (unsigned long)e->contexts,
+              e->contexts == 1 ? "" : "s",
+              e->source);
+    if (e->coremark_mhz > 0)
+        ee_printf("Scaling drift    : %+.2f%%\n", (double)e->drift_pct);
+    if (e->drifted)
+        ee_printf("WARNING! Score is %.2f%% off linear scaling from the baseline, check wait states and stability\n",
+                  (double)(e->drift_pct < 0 ? -e->drift_pct : e->drift_pct));
+}
+
+/* Function : core_baseline_calibrate
+        Store a pass of <contexts> that scored <score> at <measured_khz> as
+   the baseline for that many contexts, keeping the others of this build.
+*/
+void
+core_baseline_calibrate(secs_ret score, ee_u32 contexts, ee_u32 measured_khz)
+{
+    core_baseline b;
+    ee_u32        words[BASELINE_WORDS];
+    ee_u32        i;
+
+    if (measured_khz == 0)
+    {
+        ee_printf("Baseline         : not stored, the clock is not known\n");
+        return;
+    }
+    if (!portable_baseline_load(words) || !core_baseline_unpack(&b, words))
+    {
+        b.key   = core_baseline_key();
+        b.count = 0;
+    }
+    for (i = 0; i < b.count; i++)
+        if (b.entry[i].contexts == contexts)
+            break;
+    if (i == BASELINE_ENTRIES)
+        i = BASELINE_ENTRIES - 1;
+    else if (i == b.count)
+        b.count++;
+    b.entry[i].contexts = contexts;
+    b.entry[i].khz      = measured_khz;
+    b.entry[i].per_mhz  = (ee_u32)(score * 1000 / measured_khz * 1000000);
+    core_baseline_pack(&b, words);
+    portable_baseline_save(words);
+    baseline_calibrate = 0;
+    ee_printf("Baseline         : stored %.4f CoreMark/MHz at %.3f MHz for %lu context%s (%s)\n",
+              b.entry[i].per_mhz / 1000000.0,
+              measured_khz / 1000.0,
+              (unsigned long)contexts,
+              contexts == 1 ? "" : "s",
+              BASELINE_STORE_NAME);
+}
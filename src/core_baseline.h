@@ -0,0 +1,120 @@
+/**
+ * @file      core_baseline.h
+ *
+ * @brief Calibrated CoreMark/MHz baseline and equivalent MHz
+ */
+
+/* Topic : Description
+        A baseline is the CoreMark/MHz one build reached for a number of
+   contexts at a clock known to be good. After every pass
+   <core_baseline_report> prints the score, the CoreMark/MHz at the
+   measured clock, and the equivalent MHz, the clock the baseline would need
+   to reach the same score:
+
+        CoreMark         : <score>
+        CoreMark/MHz     : <score / measured MHz>
+        Equivalent MHz   : <score / baseline CoreMark/MHz> (<baseline used>)
+        Scaling drift    : <equivalent MHz / measured MHz - 1, in %>
+
+   When the clock was measured, the equivalent MHz is compared with it.
+   A score that does not scale with the clock, beyond BASELINE_DRIFT_PCT,
+   points at memory wait states or an unstable chip, and is flagged. For a
+   number of contexts without a baseline of its own, the one context
+   baseline is scaled, so the drift then also shows how far the contexts
+   held each other back.
+
+        Baselines come from two places. Stored ones, at most BASELINE_ENTRIES,
+   are kept by the port through <portable_baseline_load> and
+   <portable_baseline_save>, in flash or a file, and are written by
+   <core_baseline_calibrate> when the port sets <baseline_calibrate>. They
+   carry a key of the compiler, flags, memory and ISA of the build, so a
+   baseline taken by another build is not used. Built in ones are given at
+   build time as CORE_BASELINE_BUILTIN, a list of {contexts, MHz, score}
+   entries. A stored baseline wins over a built in one for the same number
+   of contexts.
+*/
+#ifndef CORE_BASELINE_H
+#define CORE_BASELINE_H
+
+#include "core_portme.h"
+
+#ifndef BASELINE_ENTRIES
+#define BASELINE_ENTRIES 8 /* Stored baselines, one per number of contexts */
+#endif
+#ifndef BASELINE_DRIFT_PCT
+#define BASELINE_DRIFT_PCT 2.0 /* Drift from linear scaling that is flagged */
+#endif
+#ifndef BASELINE_STORE_NAME
+#define BASELINE_STORE_NAME "stored" /* Where the port keeps baselines */
+#endif
+#ifndef BASELINE_ISA
+#if defined(__riscv)
+#define BASELINE_ISA "riscv"
+#elif defined(__ARM_ARCH_8M_MAIN__)
+#define BASELINE_ISA "armv8m"
+#elif defined(__ARM_ARCH_6M__)
+#define BASELINE_ISA "armv6m"
+#elif defined(__aarch64__)
+#define BASELINE_ISA "aarch64"
+#elif defined(__arm__)
+#define BASELINE_ISA "arm"
+#elif defined(__x86_64__)
+#define BASELINE_ISA "x86_64"
+#else
+#define BASELINE_ISA "unknown"
+#endif
+#endif
+
+#define BASELINE_MAGIC 0xba5e
+#define BASELINE_WORDS (3 + 2 * BASELINE_ENTRIES) /* Of a packed store */
+
+typedef struct CORE_BASELINE_ENTRY_S
+{
+    ee_u32 contexts;
+    ee_u32 khz;     /* Clock it was taken at */
+    ee_u32 per_mhz; /* CoreMark/MHz in millionths */
+} core_baseline_entry;
+
+typedef struct CORE_BASELINE_S
+{
+    ee_u32              key; /* Of the build that took them */
+    ee_u32              count;
+    core_baseline_entry entry[BASELINE_ENTRIES];
+} core_baseline;
+
+typedef struct CORE_BASELINE_EVAL_S
+{
+    secs_ret    score;
+    secs_ret    coremark_mhz;   /* At the measured clock, 0 when not measured */
+    secs_ret    baseline_mhz;   /* CoreMark/MHz of the baseline, 0 without one */
+    secs_ret    equivalent_mhz; /* 0 without a baseline */
+    secs_ret    drift_pct;      /* Of equivalent from measured MHz */
+    ee_u32      drifted;        /* Drift beyond BASELINE_DRIFT_PCT */
+    ee_u32      contexts;       /* Of the baseline used */
+    ee_u32      scaled;         /* Scaled from the one context baseline */
+    ee_u32      khz;            /* Clock of the baseline used */
+    const char *source;         /* Of the baseline used */
+} core_baseline_eval;
+
+/* Variable : baseline_calibrate
+        Non zero to store the result of the next valid pass as the baseline
+   for its number of contexts. Set by the port.
+*/
+extern ee_u32 baseline_calibrate;
+
+ee_u32 core_baseline_key(void);
+void   core_baseline_pack(const core_baseline *b, ee_u32 *words);
+ee_u32 core_baseline_unpack(core_baseline *b, const ee_u32 *words);
+void   core_baseline_eval_run(core_baseline_eval *e,
+                              secs_ret            score,
+                              ee_u32              contexts,
+                              ee_u32              measured_khz);
+void   core_baseline_report(const core_baseline_eval *e);
+void   core_baseline_calibrate(secs_ret score, ee_u32 contexts, ee_u32 measured_khz);
+
+/* Port side: read the packed store into <words>, returning 0 when there is
+ * none, and write it */
+ee_u32 portable_baseline_load(ee_u32 *words);
+void   portable_baseline_save(const ee_u32 *words);
+
+#endif /* CORE_BASELINE_H */
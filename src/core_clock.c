@@ -0,0 +1,123 @@
+/**
+ * @file      core_clock.c
+ *
+ * @brief Measurement of clk_sys during the run
+ */
+
+#include "coremark.h"
+#include "core_clock.h"
+
+#if (CLOCK_REF_HZ % 1000)
+#error "CLOCK_REF_HZ must be a whole number of kHz"
+#endif
+
+core_clock core_clock_run;
+
+/* Function : core_clock_reset
+        Forget every pair added to <c>.
+*/
+void
+core_clock_reset(core_clock *c)
+{
+    core_timebase zero = CORE_TIMEBASE_INIT;
+
+    c->ref       = zero;
+    c->cycles    = zero;
+    c->pairs     = 0;
+    c->intervals = 0;
+    c->min_khz   = 0xffffffff;
+    c->max_khz   = 0;
+    c->last_khz  = 0;
+}
+
+/* Function : core_clock_add
+        Add a pair of raw counter reads to <c>, ending an interval when at
+   least CLOCK_MIN_REF_TICKS have passed since the last one ended.
+*/
+void
+core_clock_add(core_clock *c, ee_u32 ref_raw, ee_u32 cycles_raw)
+{
+    ee_u64 ref    = core_timebase_extend(&c->ref, ref_raw);
+    ee_u64 cycles = core_timebase_extend(&c->cycles, cycles_raw);
+    ee_u64 ticks;
+    ee_u32 khz;
+
+    if (c->pairs++ == 0)
+    {
+        c->ref_first = c->ref_last = ref;
+        c->cycles_first = c->cycles_last = cycles;
+        return;
+    }
+    ticks = ref - c->ref_last;
+    if (ticks < CLOCK_MIN_REF_TICKS)
+        return;
+    khz = (ee_u32)((cycles - c->cycles_last) * (CLOCK_REF_HZ / 1000) / ticks);
+    if (khz < c->min_khz)
+        c->min_khz = khz;
+    if (khz > c->max_khz)
+        c->max_khz = khz;
+    c->last_khz    = khz;
+    c->ref_last    = ref;
+    c->cycles_last = cycles;
+    c->intervals++;
+}
+
+/* Function : core_clock_khz
+        Returns:
+        The clock over all intervals of <c> in kHz, or 0 when there are none.
+*/
+ee_u32
+core_clock_khz(const core_clock *c)
+{
+    if (c->intervals == 0)
+        return 0;
+    return (ee_u32)((c->cycles_last - c->cycles_first) * (CLOCK_REF_HZ / 1000)
+                    / (c->ref_last - c->ref_first));
+}
+
+/* Function : core_clock_print
+        Print the clock of <c> and how far it moved, when it was measured.
+*/
+void
+core_clock_print(const core_clock *c)
+{
+    if (c->intervals == 0)
+        return;
+    ee_printf("Measured clock   : %lu kHz (%lu to %lu over %lu intervals)\n",
+              (unsigned long)core_clock_khz(c),
+              (unsigned long)c->min_khz,
+              (unsigned long)c->max_khz,
+              (unsigned long)c->intervals);
+}
+
+/* Function : core_clock_start
+        Start measuring the run in <core_clock_run>.
+*/
+void
+core_clock_start(void)
+{
+    core_clock_reset(&core_clock_run);
+    core_clock_run.active = 1;
+    portable_clock_sample();
+}
+
+/* Function : core_clock_sample
+        Called by the port with both counters read together. Pairs outside
+   the timed run are ignored.
+*/
+void
+core_clock_sample(ee_u32 ref_raw, ee_u32 cycles_raw)
+{
+    if (core_clock_run.active)
+        core_clock_add(&core_clock_run, ref_raw, cycles_raw);
+}
+
+/* Function : core_clock_stop
+        Take the last pair of the run and stop measuring.
+*/
+void
+core_clock_stop(void)
+{
+    portable_clock_sample();
+    core_clock_run.active = 0;
+}
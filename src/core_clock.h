@@ -0,0 +1,68 @@
+/**
+ * @file      core_clock.h
+ *
+ * @brief Measurement of clk_sys during the run
+ */
+
+/* Topic : Description
+        With CORE_CLOCK_MEASURE, the clock the cores actually ran at is
+   measured rather than taken from what was asked for, which says nothing
+   on the ring oscillator and little near the edge of stability. The port
+   reads two free running counters together: the reference clock that
+   times the benchmark, CLOCK_REF_HZ, and a counter of clk_sys cycles. It
+   passes each pair to <core_clock_sample>, from <portable_clock_sample>
+   at the start and end of the timed run and from its periodic interrupt in
+   between.
+
+        Both counters are 32 bits wide and extended with <core_timebase>, so
+   they must be read at least once per wrap of the faster one. The clock of
+   the run is the cycles over the reference ticks between the first and last
+   pair, and the fastest and slowest intervals between pairs show how much
+   it moved. Intervals shorter than CLOCK_MIN_REF_TICKS are merged into the
+   next, since the reads of the two counters are not exactly together.
+
+        The arithmetic has no hardware dependencies, so traces of raw counter
+   pairs can be replayed through <core_clock_add> on a host.
+*/
+#ifndef CORE_CLOCK_H
+#define CORE_CLOCK_H
+
+#include "core_portme.h"
+#include "core_timebase.h"
+
+#ifndef CLOCK_REF_HZ
+#define CLOCK_REF_HZ 1000000 /* Of the reference counter */
+#endif
+#ifndef CLOCK_MIN_REF_TICKS
+#define CLOCK_MIN_REF_TICKS 1000
+#endif
+
+typedef struct CORE_CLOCK_S
+{
+    volatile ee_u32 active;
+    core_timebase   ref;    /* Extension of the raw counters */
+    core_timebase   cycles;
+    ee_u32          pairs;  /* Pairs added */
+    ee_u64          ref_first, cycles_first;
+    ee_u64          ref_last, cycles_last; /* Of the last interval ended */
+    ee_u32          intervals;
+    ee_u32          min_khz, max_khz, last_khz; /* Of single intervals */
+} core_clock;
+
+extern core_clock core_clock_run;
+
+void   core_clock_reset(core_clock *c);
+void   core_clock_add(core_clock *c, ee_u32 ref_raw, ee_u32 cycles_raw);
+ee_u32 core_clock_khz(const core_clock *c);
+void   core_clock_print(const core_clock *c);
+
+void core_clock_start(void);
+void core_clock_sample(ee_u32 ref_raw, ee_u32 cycles_raw);
+void core_clock_stop(void);
+
+/* Port side: read both counters, with nothing else touching
+ * <core_clock_run>, and pass them to <core_clock_sample>. Does nothing when
+ * the port cannot count cycles. */
+void portable_clock_sample(void);
+
+#endif /* CORE_CLOCK_H */
@@ -0,0 +1,108 @@
+/**
+ * @file      core_crash.c
+ *
+ * @brief Record of a crash that survives the reboot
+ */
+
+#include "coremark.h"
+#include "core_crash.h"
+
+/* Variable : core_crash_live
+        State of the run as it goes, which a crash record is taken from.
+*/
+core_crash core_crash_live = { CRASH_NONE, 0, 0, 0, 0, 0, { CRASH_IDLE, CRASH_IDLE }, 0, 0, 0 };
+
+static ee_u32
+crash_checksum(const ee_u32 *words)
+{
+    ee_u32 sum = 0xffffffff;
+    int    i;
+
+    for (i = 0; i < CRASH_WORDS - 1; i++)
+        sum = ((sum << 5) | (sum >> 27)) ^ words[i];
+    return sum;
+}
+
+/* Function : core_crash_encode
+        Pack <c> into CRASH_WORDS words, the last of which is a checksum of
+   the others.
+*/
+void
+core_crash_encode(const core_crash *c, ee_u32 *words)
+{
+    int i;
+
+    words[0] = ((ee_u32)CRASH_MAGIC << 16) | ((c->cause & 0xff) << 8)
+               | (c->core & 0xff);
+    words[1] = c->pc;
+    words[2] = c->lr;
+    words[3] = c->cfsr;
+    words[4] = c->hfsr;
+    for (i = 0; i < CRASH_CONTEXTS; i++)
+        words[5 + i] = c->iteration[i];
+    words[5 + CRASH_CONTEXTS] = c->mhz;
+    words[6 + CRASH_CONTEXTS] = c->vsel;
+    words[7 + CRASH_CONTEXTS] = (ee_u32)c->temp10;
+    words[CRASH_WORDS - 1]    = crash_checksum(words);
+}
+
+/* Function : core_crash_decode
+        Reverse of <core_crash_encode>.
+
+        Returns:
+        Non zero when <words> hold a record with a good checksum.
+*/
+ee_u32
+core_crash_decode(core_crash *c, const ee_u32 *words)
+{
+    int i;
+
+    if ((words[0] >> 16) != CRASH_MAGIC
+        || words[CRASH_WORDS - 1] != crash_checksum(words))
+        return 0;
+    c->cause = (words[0] >> 8) & 0xff;
+    c->core  = words[0] & 0xff;
+    c->pc    = words[1];
+    c->lr    = words[2];
+    c->cfsr  = words[3];
+    c->hfsr  = words[4];
+    for (i = 0; i < CRASH_CONTEXTS; i++)
+        c->iteration[i] = words[5 + i];
+    c->mhz    = words[5 + CRASH_CONTEXTS];
+    c->vsel   = words[6 + CRASH_CONTEXTS];
+    c->temp10 = (ee_s32)words[7 + CRASH_CONTEXTS];
+    return 1;
+}
+
+/* Function : core_crash_report
+        Print a decoded record.
+*/
+void
+core_crash_report(const core_crash *c)
+{
+    ee_s32 t = c->temp10 < 0 ? -c->temp10 : c->temp10;
+    int    i;
+
+    ee_printf("Crash          : %s on %s %lu at %lu MHz, voltage setting %lu, %s%ld.%ldC\n",
+              c->cause == CRASH_FAULT ? "hard fault" : "hang",
+              c->cause == CRASH_FAULT ? "core" : "context",
+              (unsigned long)c->core,
+              (unsigned long)c->mhz,
+              (unsigned long)c->vsel,
+              c->temp10 < 0 ? "-" : "",
+              (long)(t / 10),
+              (long)(t % 10));
+    if (c->cause == CRASH_FAULT)
+        ee_printf("Crash          : pc 0x%08lx lr 0x%08lx cfsr 0x%08lx hfsr 0x%08lx\n",
+                  (unsigned long)c->pc,
+                  (unsigned long)c->lr,
+                  (unsigned long)c->cfsr,
+                  (unsigned long)c->hfsr);
+    for (i = 0; i < CRASH_CONTEXTS; i++)
+    {
+        if (c->iteration[i] == CRASH_IDLE)
+            ee_printf("[%d]crash        : not iterating\n", i);
+        else
+            ee_printf("[%d]crash        : in iteration %lu\n", i, (unsigned long)c->iteration[i]);
+    }
+}
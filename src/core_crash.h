@@ -0,0 +1,56 @@
+/**
+ * @file      core_crash.h
+ *
+ * @brief Record of a crash that survives the reboot
+ */
+
+/* Topic : Description
+        With CORE_CRASH_RECORD, <iterate> keeps the iteration each context is
+   in up to date in <core_crash_live>, and the port keeps its clock, voltage
+   and last temperature there. When the port catches a fault, or sees a
+   context stop making progress, it fills in the cause, registers and core,
+   and encodes the record into memory that a reboot does not clear. After
+   the reboot the port decodes it and prints it with <core_crash_report>, so
+   a crash is a data point rather than a run that went quiet.
+
+        The encoded record starts with a magic number and ends with a
+   checksum, so memory that was never written is not mistaken for one.
+*/
+#ifndef CORE_CRASH_H
+#define CORE_CRASH_H
+
+#include "core_portme.h"
+
+#define CRASH_CONTEXTS 2          /* Contexts whose iteration is kept */
+#define CRASH_WORDS    11         /* Words of an encoded record */
+#define CRASH_MAGIC    0xc4a5
+#define CRASH_IDLE     0xffffffff /* Iteration of a context not running */
+
+enum CORE_CRASH_CAUSE
+{
+    CRASH_NONE = 0,
+    CRASH_FAULT, /* Hard fault, with the stacked registers */
+    CRASH_HANG   /* A context stopped making progress */
+};
+
+typedef struct CORE_CRASH_S
+{
+    ee_u32 cause;
+    ee_u32 core;   /* Core that faulted, or context that hung */
+    ee_u32 pc;     /* Stacked registers of a fault, else 0 */
+    ee_u32 lr;
+    ee_u32 cfsr;   /* Configurable fault status */
+    ee_u32 hfsr;   /* Hard fault status */
+    ee_u32 iteration[CRASH_CONTEXTS]; /* Of each context, or CRASH_IDLE */
+    ee_u32 mhz;    /* clk_sys, 0 for the ROSC */
+    ee_u32 vsel;   /* Port specific voltage setting */
+    ee_s32 temp10; /* Last temperature read, in tenths of a degree C */
+} core_crash;
+
+extern core_crash core_crash_live;
+
+void   core_crash_encode(const core_crash *c, ee_u32 *words);
+ee_u32 core_crash_decode(core_crash *c, const ee_u32 *words);
+void   core_crash_report(const core_crash *c);
+
+#endif /* CORE_CRASH_H */
@@ -0,0 +1,413 @@
+/**
+ * @file      core_diag.c
+ *
+ * @brief Replay of a diverged iteration one kernel step at a time
+ */
+
+#include "coremark.h"
+#include "core_golden.h"
+#include "core_diag.h"
+#include <string.h>
+
+#if CORE_DIAGNOSE
+
+/* Kernel internals, replayed one call at a time */
+ee_s16 matrix_sum(ee_u32 N, MATRES *C, MATDAT clipval);
+void   matrix_mul_const(ee_u32 N, MATRES *C, MATDAT *A, MATDAT val);
+void   matrix_mul_vect(ee_u32 N, MATRES *C, MATDAT *A, MATDAT *B);
+void   matrix_mul_matrix(ee_u32 N, MATRES *C, MATDAT *A, MATDAT *B);
+void   matrix_mul_matrix_bitextract(ee_u32 N, MATRES *C, MATDAT *A, MATDAT *B);
+void   matrix_add_const(ee_u32 N, MATDAT *A, MATDAT val);
+enum CORE_STATE core_state_transition(ee_u8 **instr, ee_u32 *transition_count);
+
+#define matrix_big(x) (0xf000 | (x))
+
+static ee_u32 diag_ctx;
+
+/* Function : report_diff
+        Print the first element a step got wrong.
+*/
+static void
+report_diff(const char *step, const char *what, ee_u32 index, ee_u32 got, ee_u32 expect)
+{
+    ee_printf("[%u]ERROR! %s diverged at %s[%lu]: 0x%lx should be 0x%lx\n",
+              diag_ctx,
+              step,
+              what,
+              (unsigned long)index,
+              (unsigned long)got,
+              (unsigned long)expect);
+}
+
+/* Function : report_bytes
+        Compare two byte ranges and report the first difference.
+
+        Returns:
+        Non zero when they differ.
+*/
+static int
+report_bytes(const char *step, const char *what, const ee_u8 *got, const ee_u8 *expect, ee_u32 n)
+{
+    ee_u32 i;
+
+    for (i = 0; i < n; i++)
+    {
+        if (got[i] != expect[i])
+        {
+            report_diff(step, what, i, got[i], expect[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Topic : Matrix
+        The steps of <matrix_test>, each compared on the array it writes.
+*/
+#define MATRIX_STEPS 10
+static const char *matrix_step_name[MATRIX_STEPS] = {
+    "matrix_add_const", "matrix_mul_const",  "matrix_sum",
+    "matrix_mul_vect",  "matrix_sum",        "matrix_mul_matrix",
+    "matrix_sum",       "matrix_mul_matrix_bitextract",
+    "matrix_sum",       "matrix_add_const"
+};
+
+static ee_s16
+matrix_step(mat_params *p, int k, MATDAT val)
+{
+    switch (k)
+    {
+        case 0:
+            matrix_add_const(p->N, p->A, val);
+            break;
+        case 1:
+            matrix_mul_const(p->N, p->C, p->A, val);
+            break;
+        case 3:
+            matrix_mul_vect(p->N, p->C, p->A, p->B);
+            break;
+        case 5:
+            matrix_mul_matrix(p->N, p->C, p->A, p->B);
+            break;
+        case 7:
+            matrix_mul_matrix_bitextract(p->N, p->C, p->A, p->B);
+            break;
+        case 9:
+            matrix_add_const(p->N, p->A, -val);
+            break;
+        default:
+            return matrix_sum(p->N, p->C, matrix_big(val));
+    }
+    return 0;
+}
+
+static int
+replay_matrix(core_results *res, core_results *ref)
+{
+    ee_u32 n = ref->mat.N * ref->mat.N, i;
+    MATDAT val = (MATDAT)ref->diag_matrix_seed;
+    ee_s16 got, expect;
+    int    k;
+
+    for (k = 0; k < MATRIX_STEPS; k++)
+    {
+        portable_safe_clock(1);
+        expect = matrix_step(&ref->mat, k, val);
+        portable_safe_clock(0);
+        got = matrix_step(&res->mat, k, val);
+        if (got != expect)
+        {
+            report_diff(matrix_step_name[k], "sum", 0, (ee_u16)got, (ee_u16)expect);
+            return 1;
+        }
+        for (i = 0; i < n; i++)
+        {
+            if (k == 0 || k == 9)
+            {
+                if (res->mat.A[i] != ref->mat.A[i])
+                {
+                    report_diff(matrix_step_name[k], "A", i, (ee_u16)res->mat.A[i], (ee_u16)ref->mat.A[i]);
+                    return 1;
+                }
+            }
+            else if (res->mat.C[i] != ref->mat.C[i])
+            {
+                report_diff(matrix_step_name[k], "C", i, (ee_u32)res->mat.C[i], (ee_u32)ref->mat.C[i]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Topic : State
+        The four passes of <core_bench_state>. The scans record the state
+   and end offset of every token so the first token that went wrong can be
+   named.
+*/
+#define STATE_STEPS 4
+static const char *state_step_name[STATE_STEPS] = {
+    "core_state_transition", "state corruption", "core_state_transition", "state undo"
+};
+
+typedef struct STATE_REPLAY_S
+{
+    ee_u8 *blk;
+    ee_u32 size;
+    ee_u32 final_counts[NUM_CORE_STATES];
+    ee_u32 track_counts[NUM_CORE_STATES];
+    ee_u32 *tokens; /* State << 24 | end offset, per token */
+    ee_u32 ntokens;
+} state_replay;
+
+static void
+state_step(state_replay *s, int k, ee_s16 seed1, ee_s16 seed2, ee_s16 step)
+{
+    enum CORE_STATE fstate;
+    ee_u8 *         p = s->blk;
+
+    if (k == 0 || k == 2)
+    {
+        s->ntokens = 0;
+        while (*p != 0)
+        {
+            fstate = core_state_transition(&p, s->track_counts);
+            s->final_counts[fstate]++;
+            if (s->ntokens < s->size)
+                s->tokens[s->ntokens] = ((ee_u32)fstate << 24) | (ee_u32)(p - s->blk);
+            s->ntokens++;
+        }
+        return;
+    }
+    while (p < s->blk + s->size)
+    {
+        if (*p != ',')
+            *p ^= (ee_u8)(k == 1 ? seed1 : seed2);
+        p += step;
+    }
+}
+
+static int
+replay_state(core_results *res, core_results *ref)
+{
+    state_replay got, expect;
+    ee_u32       i;
+    int          k, diverged = 0;
+
+    memset(&got, 0, sizeof(got));
+    memset(&expect, 0, sizeof(expect));
+    got.blk = res->memblock[3];
+    expect.blk = ref->memblock[3];
+    got.size = expect.size = ref->size;
+    got.tokens = (ee_u32 *)portable_malloc(ref->size * sizeof(ee_u32));
+    expect.tokens = (ee_u32 *)portable_malloc(ref->size * sizeof(ee_u32));
+    for (k = 0; k < STATE_STEPS && !diverged; k++)
+    {
+        portable_safe_clock(1);
+        state_step(&expect, k, ref->seed1, ref->seed2, ref->diag_state_step);
+        portable_safe_clock(0);
+        state_step(&got, k, ref->seed1, ref->seed2, ref->diag_state_step);
+        if (k == 1 || k == 3)
+        {
+            diverged = report_bytes(state_step_name[k], "input", got.blk, expect.blk, got.size);
+            continue;
+        }
+        for (i = 0; i < got.ntokens && i < expect.ntokens && i < got.size && !diverged; i++)
+        {
+            if (got.tokens[i] != expect.tokens[i])
+            {
+                report_diff(state_step_name[k], "token", i, got.tokens[i], expect.tokens[i]);
+                diverged = 1;
+            }
+        }
+        if (!diverged && got.ntokens != expect.ntokens)
+        {
+            report_diff(state_step_name[k], "tokens", 0, got.ntokens, expect.ntokens);
+            diverged = 1;
+        }
+        for (i = 0; i < NUM_CORE_STATES && !diverged; i++)
+        {
+            if (got.track_counts[i] != expect.track_counts[i])
+            {
+                report_diff(state_step_name[k], "track_counts", i, got.track_counts[i], expect.track_counts[i]);
+                diverged = 1;
+            }
+        }
+    }
+    portable_free(got.tokens);
+    portable_free(expect.tokens);
+    return diverged;
+}
+
+/* Topic : List
+        The steps of <core_bench_list>, run by <core_list_bench_step>, for
+   both calls <iterate> makes. After each step the lists are compared node by
+   node. The matrix and state kernels run inside the cmp_complex sort.
+*/
+static const char *list_step_name[LIST_BENCH_STEPS] = {
+    "core_list_find", "core_list_mergesort(cmp_complex)", "core_list_remove",
+    "core_list_undo_remove", "core_list_mergesort(cmp_idx)"
+};
+
+/* Function : report_lists
+        Compare two lists node by node, by index and data.
+
+        Returns:
+        Non zero when they differ.
+*/
+static int
+report_lists(const char *step, list_head *got, list_head *expect)
+{
+    ee_u32 i, a, b;
+
+    for (i = 0; got || expect; i++)
+    {
+        a = got ? ((ee_u32)(ee_u16)got->info->idx << 16) | (ee_u16)got->info->data16 : 0;
+        b = expect ? ((ee_u32)(ee_u16)expect->info->idx << 16) | (ee_u16)expect->info->data16 : 0;
+        if (a != b || !got || !expect)
+        {
+            report_diff(step, "node", i, a, b);
+            return 1;
+        }
+        got = got->next;
+        expect = expect->next;
+    }
+    return 0;
+}
+
+static int
+replay_list(core_results *res, core_results *ref)
+{
+    list_bench got, expect;
+    ee_s16     finder_idx;
+    int        call, k;
+
+    for (call = 0; call < 2; call++)
+    {
+        finder_idx = call == 0 ? 1 : -1;
+        for (k = 0; k < LIST_BENCH_STEPS; k++)
+        {
+            portable_safe_clock(1);
+            core_list_bench_step(&expect, k, ref, finder_idx);
+            portable_safe_clock(0);
+            core_list_bench_step(&got, k, res, finder_idx);
+            /* the running crc takes each call's result, as <iterate> does */
+            if (k == LIST_BENCH_STEPS - 1)
+            {
+                ref->crc = crcu16(expect.retval, ref->crc);
+                res->crc = crcu16(got.retval, res->crc);
+            }
+            if (report_lists(list_step_name[k], got.list, expect.list))
+                return 1;
+            if (got.retval != expect.retval)
+            {
+                report_diff(list_step_name[k], "crc", 0, got.retval, expect.retval);
+                return 1;
+            }
+            /* calc_func adds the matrix and state results in here */
+            if (res->crc != ref->crc)
+            {
+                report_diff(list_step_name[k], "running crc", 0, res->crc, ref->crc);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Function : core_diagnose
+        Replay the iteration <res> diverged in, see <core_diag.h>. The
+   reference is rebuilt by running every earlier iteration from the seeds at
+   the safe clock, and has to end on the trace of <golden>.
+*/
+void
+core_diagnose(core_results *res, ee_u32 ctx, const core_golden *golden)
+{
+    static const char *kernel_name[] = { "list", "matrix", "state" };
+    core_results ref;
+    ee_u32       size = res->diag_size, it = res->fail_iteration, i;
+    ee_u8 *      refblock, *refsave;
+    ee_u32       kernel;
+    ee_u16       crc;
+    int          found = 0;
+
+    diag_ctx = ctx;
+    for (i = 0; (1u << i) != res->fail_kernel; i++)
+        ;
+    ee_printf("[%u]diagnosis      : replaying %s in iteration %lu\n",
+              ctx, kernel_name[i], (unsigned long)it);
+    refblock = (ee_u8 *)portable_malloc(size);
+    refsave = (ee_u8 *)portable_malloc(size);
+
+    portable_safe_clock(1);
+    memset(&ref, 0, sizeof(ref));
+    ref.seed1 = res->seed1;
+    ref.seed2 = res->seed2;
+    ref.seed3 = res->seed3;
+    ref.execs = res->execs;
+    core_golden_init(&ref, refblock, size);
+    for (i = 0; i < it; i++)
+        core_golden_iteration(&ref);
+    if (it > 0 && ref.crc != golden->trace[it - 1].crc)
+    {
+        portable_safe_clock(0);
+        ee_printf("[%u]diagnosis      : reference does not match the trace, giving up\n", ctx);
+        goto out;
+    }
+
+    /* the failing context's inputs, against the reference */
+    memcpy(res->memblock[0], res->diag_block, size);
+    res->crc = res->diag_crc;
+    if (res->crc != ref.crc)
+    {
+        report_diff("iterate", "crc", 0, res->crc, ref.crc);
+        found = 1;
+    }
+    if (res->execs & ID_LIST)
+        found |= report_lists("input", res->list, ref.list);
+    if (res->execs & ID_MATRIX)
+        found |= report_bytes("input", "matrix", res->memblock[2], ref.memblock[2], ref.size);
+    if (res->execs & ID_STATE)
+        found |= report_bytes("input", "state", res->memblock[3], ref.memblock[3], ref.size);
+
+    /* a full reference pass gives the arguments of the first matrix and
+     * state calls, then the block is put back to the start */
+    memcpy(refsave, refblock, size);
+    crc = ref.crc;
+    core_golden_iteration(&ref);
+    memcpy(refblock, refsave, size);
+    ref.crc = crc;
+    portable_safe_clock(0);
+
+    /* the first matrix or state result also depends on the running CRC, so
+     * a kernel called with a different one went wrong before it, somewhere
+     * in the list phases */
+    kernel = res->fail_kernel;
+    if ((kernel == ID_MATRIX
+         && (res->diag_matrix_seed != ref.diag_matrix_seed
+             || res->diag_matrix_crc != ref.diag_matrix_crc))
+        || (kernel == ID_STATE
+            && (res->diag_state_step != ref.diag_state_step
+                || res->diag_state_crc != ref.diag_state_crc)))
+    {
+        ee_printf("[%u]diagnosis      : %s called with crc 0x%04x, should be 0x%04x, replaying the list\n",
+                  ctx,
+                  kernel == ID_MATRIX ? "matrix" : "state",
+                  kernel == ID_MATRIX ? res->diag_matrix_crc : res->diag_state_crc,
+                  kernel == ID_MATRIX ? ref.diag_matrix_crc : ref.diag_state_crc);
+        kernel = ID_LIST;
+    }
+    if (kernel == ID_MATRIX)
+        found |= replay_matrix(res, &ref);
+    else if (kernel == ID_STATE)
+        found |= replay_state(res, &ref);
+    else
+        found |= replay_list(res, &ref);
+    if (!found)
+        ee_printf("[%u]diagnosis      : not reproduced, every step matched\n", ctx);
+out:
+    portable_free(refsave);
+    portable_free(refblock);
+}
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file      core_diag.h
+ *
+ * @brief Replay of a diverged iteration one kernel step at a time
+ */
+
+/* Topic : Description
+        When <CORE_ITERATION_CHECK> stops a run, the memory block and running
+   CRC the failing iteration started from are known (<iterate> snapshots
+   them with CORE_DIAGNOSE). <core_diagnose> rebuilds the same iteration from
+   the seeds at the port's safe clock, checks the snapshot against it, and
+   then replays the failing kernel step by step on both: each step runs on
+   the reference at the safe clock and on the snapshot at the run clock, and
+   the data is compared after every step. The first step and element that
+   differ point at the functional unit that fails. A matrix or state kernel
+   that was called with a different running CRC went wrong earlier in the
+   iteration, so the list phases are replayed instead.
+
+        The replay runs on the core that calls it, which need not be the core
+   that failed.
+*/
+#ifndef CORE_DIAG_H
+#define CORE_DIAG_H
+
+#include "core_portme.h"
+
+struct RESULTS_S;
+struct CORE_GOLDEN_S;
+
+void core_diagnose(struct RESULTS_S *           res,
+                   ee_u32                       ctx,
+                   const struct CORE_GOLDEN_S *golden);
+
+#endif /* CORE_DIAG_H */
@@ -0,0 +1,137 @@
+/**
+ * @file      core_golden.c
+ *
+ * @brief Reference CRCs for seeds and sizes chosen at build time
+ */
+
+#include "coremark.h"
+#include "core_golden.h"
+#include <string.h>
+
+/* Variable : golden_table
+        Generated by tools/coremark_golden.c, ended by an entry of size 0.
+   The default configurations are checked in as core_golden_default.h, and
+   a build with extra ones defines COREMARK_GOLDEN_TABLE and generates
+   core_golden_table.h with both. The traces are only compiled in with
+   CORE_ITERATION_CHECK.
+*/
+#if COREMARK_GOLDEN_TABLE
+#include "core_golden_table.h"
+#else
+#include "core_golden_default.h"
+#endif
+
+/* Function : core_golden_find
+        Look up the reference CRCs for a run.
+
+        Returns:
+        The entry, or NULL when the configuration was not generated.
+*/
+const core_golden *
+core_golden_find(ee_s16 seed1,
+                 ee_s16 seed2,
+                 ee_s16 seed3,
+                 ee_u32 execs,
+                 ee_u32 size)
+{
+    const core_golden *g;
+
+    for (g = golden_table; g->size != 0; g++)
+        if (g->seed1 == seed1 && g->seed2 == seed2 && g->seed3 == seed3
+            && g->execs == execs && g->size == size)
+            return g;
+    return NULL;
+}
+
+/* Function : core_golden_init
+        Split <memblock>, of <size> bytes, between the algorithms in
+   res->execs and initialize each from the seeds in <res>, as <core_main.c>
+   does.
+*/
+void
+core_golden_init(core_results *res, void *memblock, ee_u32 size)
+{
+    ee_u32 i, j = 0, num_algorithms = 0;
+
+    res->memblock[0] = memblock;
+    for (i = 0; i < NUM_ALGORITHMS; i++)
+        if ((1 << i) & res->execs)
+            num_algorithms++;
+    res->size = size / num_algorithms;
+    for (i = 0; i < NUM_ALGORITHMS; i++)
+        if ((1 << i) & res->execs)
+            res->memblock[i + 1] = (char *)memblock + res->size * j++;
+    if (res->execs & ID_LIST)
+        res->list = core_list_init(res->size, res->memblock[1], res->seed1);
+    if (res->execs & ID_MATRIX)
+        core_init_matrix(res->size,
+                         res->memblock[2],
+                         (ee_s32)res->seed1 | (((ee_s32)res->seed2) << 16),
+                         &res->mat);
+    if (res->execs & ID_STATE)
+        core_init_state(res->size, res->seed1, res->memblock[3]);
+}
+
+/* Function : core_golden_iteration
+        Run one iteration of <iterate>, with the matrix and state CRCs
+   started afresh as in a trace.
+*/
+void
+core_golden_iteration(core_results *res)
+{
+    ee_u16 crc;
+
+    res->crcmatrix = 0;
+    res->crcstate  = 0;
+    crc            = core_bench_list(res, 1);
+    res->crc       = crcu16(crc, res->crc);
+    crc            = core_bench_list(res, -1);
+    res->crc       = crcu16(crc, res->crc);
+}
+
+/* Function : core_golden_compute
+        Fill in the outputs of <g> by running the kernels over <memblock>,
+   which holds g->size bytes. At least one iteration is run so the first
+   iteration CRCs are always set.
+
+        When <trace> is not NULL it receives g->iterations entries, as
+   <iterate> checks them.
+*/
+void
+core_golden_compute(core_golden *g, void *memblock, core_golden_iter *trace)
+{
+    core_results res;
+    ee_u32       i, iterations;
+    ee_u16       crcmatrix = 0, crcstate = 0;
+
+    memset(&res, 0, sizeof(res));
+    res.seed1 = g->seed1;
+    res.seed2 = g->seed2;
+    res.seed3 = g->seed3;
+    res.execs = g->execs;
+    core_golden_init(&res, memblock, g->size);
+
+    iterations = g->iterations ? g->iterations : 1;
+    for (i = 0; i < iterations; i++)
+    {
+        core_golden_iteration(&res);
+        if (i == 0)
+        {
+            res.crclist = res.crc;
+            crcmatrix   = res.crcmatrix;
+            crcstate    = res.crcstate;
+        }
+        if (trace && i < g->iterations)
+        {
+            trace[i].crc       = res.crc;
+            trace[i].crcmatrix = res.crcmatrix;
+            trace[i].crcstate  = res.crcstate;
+        }
+    }
+    res.crcmatrix = crcmatrix;
+    res.crcstate  = crcstate;
+    g->crclist   = res.crclist;
+    g->crcmatrix = res.crcmatrix;
+    g->crcstate  = res.crcstate;
+    g->crc       = g->iterations ? res.crc : 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file      core_golden.h
+ *
+ * @brief Reference CRCs for seeds and sizes chosen at build time
+ */
+
+/* Topic : Description
+        The five seed and size combinations of upstream CoreMark have their
+   CRCs hard coded in <core_main.c>. Other configurations are computed by
+   running the reference kernels on the host (tools/coremark_golden.c): the
+   defaults, COREMARK_GOLDEN_DEFAULT in CMakeLists.txt, into the checked in
+   core_golden_default.h, and any extras listed in COREMARK_GOLDEN_CONFIGS
+   at configure time, along with the defaults, into a generated
+   core_golden_table.h. <core_golden_find> looks a run up in that table.
+
+        The kernels size their data by item counts that do not depend on
+   pointer size, so CRCs computed on the host hold on the RP2.
+
+        Entries with an iteration count also carry a trace of the CRCs of
+   every iteration, for <CORE_ITERATION_CHECK>. Each iteration starts the
+   matrix and state CRCs afresh, so the trace holds the first result of each
+   kernel in that iteration rather than the first of the run.
+*/
+#ifndef CORE_GOLDEN_H
+#define CORE_GOLDEN_H
+
+#include "core_portme.h"
+
+typedef struct CORE_GOLDEN_ITER_S
+{
+    ee_u16 crc;       /* Running CRC at the end of the iteration */
+    ee_u16 crcmatrix; /* First matrix result of the iteration, or 0 */
+    ee_u16 crcstate;  /* First state result of the iteration, or 0 */
+} core_golden_iter;
+
+typedef struct CORE_GOLDEN_S
+{
+    /* inputs */
+    ee_s16 seed1;
+    ee_s16 seed2;
+    ee_s16 seed3;
+    ee_u32 execs;      /* Bitmask of algorithms run */
+    ee_u32 size;       /* Memory block per context, before the split */
+    ee_u32 iterations; /* Iterations <crc> is for, 0 if it was not computed */
+    /* outputs */
+    ee_u16 crclist;
+    ee_u16 crcmatrix;
+    ee_u16 crcstate;
+    ee_u16 crc;
+    const core_golden_iter *trace; /* <iterations> entries, or NULL */
+} core_golden;
+
+const core_golden *core_golden_find(ee_s16 seed1,
+                                    ee_s16 seed2,
+                                    ee_s16 seed3,
+                                    ee_u32 execs,
+                                    ee_u32 size);
+void               core_golden_compute(core_golden *     g,
+                                       void *            memblock,
+                                       core_golden_iter *trace);
+
+struct RESULTS_S;
+void core_golden_init(struct RESULTS_S *res, void *memblock, ee_u32 size);
+void core_golden_iteration(struct RESULTS_S *res);
+
+#endif /* CORE_GOLDEN_H */
@@ -0,0 +1,4039 @@
+/* Generated by coremark_golden, do not edit, from
+ *   0,0,0x66,2000,4000
+ *   0,0,0x66,4000
+ *   0,0,0x66,8000
+ *   0,0,0x66,16000
+ *   0,0,0x66,32000
+ *   0,0,0x66,64000
+ *   0,0,0x66,128000
+ */
+#if CORE_ITERATION_CHECK
+static const core_golden_iter golden_trace_0[] = {
+    { 0xe714, 0x1fd7, 0x8e3a },
+    { 0x72be, 0xe45e, 0x7acd },
+    { 0x2e87, 0x441c, 0x276f },
+    { 0x9f95, 0xab6c, 0xa410 },
+    { 0xf24c, 0x070f, 0xfaf3 },
+    { 0x9db0, 0x1300, 0x6305 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+    { 0xeeb8, 0xfec9, 0x9c39 },
+    { 0xe5dc, 0xd40e, 0x33a6 },
+    { 0x8b11, 0x6bc0, 0x5d40 },
+    { 0x8bcc, 0xf441, 0xb103 },
+    { 0x414d, 0xf6fd, 0x7c43 },
+    { 0x2a29, 0xb257, 0xdf20 },
+    { 0xa47c, 0xb264, 0x8038 },
+    { 0x79dc, 0x8443, 0x8142 },
+    { 0x86e5, 0x7bc4, 0x4182 },
+    { 0x0158, 0x5f4f, 0xd570 },
+    { 0x03ee, 0x5888, 0x6db3 },
+    { 0x4cb6, 0x5620, 0xe2a9 },
+    { 0xaeb6, 0x197d, 0x0f41 },
+    { 0xd5f4, 0xfe84, 0x051d },
+    { 0xd495, 0x54de, 0x25cb },
+    { 0x0dba, 0xd30c, 0x3a03 },
+    { 0x2e06, 0x7550, 0x0286 },
+    { 0xc7d9, 0x283e, 0xb9ae },
+    { 0x7499, 0x73dd, 0x98ef },
+    { 0xa14c, 0x1327, 0x7817 },
+    { 0x75a1, 0x18fd, 0x0f8b },
+    { 0xef57, 0xd506, 0x1b2e },
+    { 0x6ab4, 0xd0aa, 0x85c2 },
+    { 0x1d53, 0x5bdb, 0x930c },
+    { 0xbaf8, 0x9de2, 0x8839 },
+    { 0xb247, 0x8f0c, 0x1793 },
+    { 0x87a0, 0xf997, 0xf9b1 },
+    { 0x3ae2, 0x5853, 0xbada },
+    { 0x14b8, 0x5a0e, 0x72ee },
+    { 0x3978, 0xec09, 0x9584 },
+    { 0x021f, 0x52f6, 0xaef7 },
+    { 0xdfc8, 0x52cc, 0x7cea },
+    { 0x5ea2, 0xac4f, 0xa8a4 },
+    { 0x336f, 0xfef3, 0x4e24 },
+    { 0x64b6, 0x2a8d, 0xe7e8 },
+    { 0xe6dc, 0x397c, 0xbbc0 },
+    { 0xdc15, 0x203f, 0x18cf },
+    { 0x5327, 0xe50c, 0x206b },
+    { 0x0107, 0xd4ef, 0x36d2 },
+    { 0x5275, 0x996d, 0x1949 },
+    { 0xee0f, 0x5389, 0xcd46 },
+    { 0x8e4e, 0x97f5, 0x664b },
+    { 0x235b, 0xe9a5, 0x0b68 },
+    { 0x3ac9, 0xc083, 0xa017 },
+    { 0xf826, 0xdae4, 0xb69e },
+    { 0xa179, 0xaa46, 0x2689 },
+    { 0x8529, 0x985f, 0xe3dc },
+    { 0x8ec0, 0x1660, 0xc18a },
+    { 0xeadc, 0x6ad3, 0xa2c4 },
+    { 0xc006, 0x4fc0, 0x4ef0 },
+    { 0xa088, 0xa038, 0xe5cd },
+    { 0x1657, 0x9cb3, 0x7d9f },
+    { 0x7ed4, 0xa352, 0x666f },
+    { 0x9387, 0x6aa4, 0xe9fd },
+    { 0x3f14, 0x2897, 0x94fd },
+    { 0xcbab, 0x0459, 0xb54f },
+    { 0x1320, 0xdd3b, 0x7651 },
+    { 0xf98b, 0x7e57, 0xbc70 },
+    { 0xa0ca, 0x2f44, 0x6834 },
+    { 0x988c, 0x1d15, 0x8546 },
+    { 0xf533, 0x1603, 0xceb9 },
+    { 0xd940, 0x0364, 0xdff4 },
+    { 0x6042, 0x38d1, 0x821d },
+    { 0x8957, 0x218c, 0x471d },
+    { 0x2424, 0xf8a9, 0x3f22 },
+    { 0x51f8, 0xd0e7, 0x1ce6 },
+    { 0x2c1a, 0xdb0b, 0x8561 },
+    { 0x3c53, 0x252e, 0xef7a },
+    { 0x178d, 0x0e1d, 0xa416 },
+    { 0x0134, 0x2754, 0x3c5c },
+    { 0x6452, 0x99d9, 0xfd15 },
+    { 0x1188, 0xfb4d, 0x8ac1 },
+    { 0xaac5, 0x70b7, 0x1b4d },
+    { 0x249c, 0xe530, 0xec75 },
+    { 0x3461, 0x9338, 0xfd19 },
+    { 0xb77b, 0xbbfb, 0x479c },
+    { 0x4680, 0x2506, 0x676e },
+    { 0x2f73, 0x21d5, 0x9a33 },
+    { 0x0912, 0x6f9d, 0x965c },
+    { 0xd340, 0xec4e, 0x2ea5 },
+    { 0xd259, 0xc0d0, 0x5f3c },
+    { 0x7b2e, 0x4622, 0xe068 },
+    { 0x81c9, 0x74dc, 0x3e4a },
+    { 0xf6af, 0xcee1, 0x0d6d },
+    { 0x0948, 0x8b8a, 0x0be6 },
+    { 0x8722, 0xedb6, 0xf650 },
+    { 0xa1f8, 0x9b0a, 0x0360 },
+    { 0xdd65, 0x1b0d, 0xfe62 },
+    { 0x0815, 0x62b2, 0xa396 },
+    { 0x6621, 0x6af4, 0xb9d6 },
+    { 0x6ee9, 0x7707, 0xe8b7 },
+    { 0x055c, 0x0098, 0x121b },
+    { 0x1cd5, 0x4238, 0x9055 },
+    { 0x57d5, 0x980a, 0x02f4 },
+    { 0x37e3, 0x4c09, 0xc204 },
+    { 0x7b65, 0x335d, 0xbba9 },
+    { 0xc7b6, 0x7548, 0x7a8a },
+    { 0xd073, 0xf287, 0xac4d },
+    { 0xb37a, 0x8b9b, 0xfeef },
+    { 0xcc42, 0xffab, 0x3687 },
+    { 0xf4ef, 0xce77, 0x4320 },
+    { 0x600f, 0x0774, 0x8dcc },
+    { 0x0987, 0xa00e, 0x0bd6 },
+    { 0x9ce8, 0xaf6d, 0x0321 },
+    { 0xd0e9, 0x8dcd, 0xb3ef },
+    { 0xf2d9, 0xc89c, 0x6779 },
+    { 0xfdd9, 0x5023, 0x4e81 },
+    { 0xb6ce, 0x7423, 0x5d31 },
+    { 0x9d8a, 0x205a, 0x09ff },
+    { 0xca90, 0x4a14, 0x0823 },
+    { 0x9e6d, 0x5b11, 0xb16c },
+    { 0xa996, 0x83d1, 0xd8a9 },
+    { 0xef5e, 0x2f05, 0xcd16 },
+    { 0xa210, 0x5098, 0x39db },
+    { 0xb068, 0xd2ec, 0x9afa },
+    { 0x4a0d, 0xf433, 0x4b39 },
+    { 0xa671, 0x8d57, 0xc1a4 },
+    { 0x904b, 0x893f, 0x4ba3 },
+    { 0xb08c, 0x61b8, 0x8007 },
+    { 0xbd59, 0x3602, 0x7a38 },
+    { 0xd0a1, 0xdddf, 0xc226 },
+    { 0x77f0, 0x8903, 0x87bd },
+    { 0x940d, 0x5994, 0x0131 },
+    { 0xb16c, 0xfaae, 0x8538 },
+    { 0x3c3a, 0x3282, 0x784e },
+    { 0x75c8, 0x0f51, 0x98bf },
+    { 0x8d12, 0xd44a, 0x2787 },
+    { 0xe692, 0x23b4, 0x9e19 },
+    { 0xbf92, 0xe1b6, 0xf000 },
+    { 0xea58, 0x124a, 0x41af },
+    { 0x9db3, 0x0c8f, 0xff41 },
+    { 0xf745, 0x8a99, 0xf462 },
+    { 0x83d9, 0x4f33, 0x118d },
+    { 0xc078, 0x83de, 0x4baf },
+    { 0x167f, 0x210e, 0x4d5a },
+    { 0x511c, 0x63b3, 0x061b },
+    { 0xdb4e, 0x193a, 0xb460 },
+    { 0x4a83, 0x75a6, 0xecf8 },
+    { 0xf036, 0x0e21, 0x6808 },
+    { 0x25b5, 0x1f78, 0xbd6a },
+    { 0x6867, 0x5575, 0x0215 },
+    { 0xd2d2, 0x1410, 0x30a9 },
+    { 0x2890, 0x0549, 0xe5cb },
+    { 0xe52f, 0xbce8, 0xbb30 },
+    { 0xa8f7, 0x298b, 0xf87f },
+    { 0x3671, 0xa8d7, 0xd2de },
+    { 0x81ac, 0xf6c4, 0x015e },
+    { 0x59b7, 0x8f82, 0x21d2 },
+    { 0xf94d, 0xafd0, 0x6a78 },
+    { 0x53a5, 0xedad, 0x215c },
+    { 0x9a1d, 0x17b6, 0x8f68 },
+    { 0x9ba8, 0xd86e, 0x95c5 },
+    { 0x6f63, 0xdd32, 0xfb54 },
+    { 0x252c, 0x455f, 0x88c0 },
+    { 0xea92, 0x5679, 0x3f87 },
+    { 0x8380, 0x8e49, 0xa63f },
+    { 0x574c, 0xc22d, 0x375e },
+    { 0x2ad6, 0x4f05, 0xff96 },
+    { 0x6506, 0xb000, 0x3511 },
+    { 0x382f, 0xfc3d, 0x795e },
+    { 0xe8ee, 0x158d, 0xf96c },
+    { 0xd2eb, 0x0227, 0x705b },
+    { 0x1545, 0xc5c4, 0x198a },
+    { 0xf89b, 0xa8ca, 0x1bd1 },
+    { 0xc119, 0x2984, 0x6b79 },
+    { 0xcf50, 0xa6dc, 0x5292 },
+    { 0x72a0, 0xc5ef, 0x3e9e },
+    { 0x3291, 0x4454, 0x0f48 },
+    { 0xf9c3, 0x2e45, 0xcdb9 },
+    { 0x25e3, 0x6edb, 0x88f0 },
+    { 0xf158, 0x14a2, 0xcaf6 },
+    { 0xf291, 0x988e, 0x16b0 },
+    { 0xe730, 0x11bc, 0xae45 },
+    { 0x902b, 0x6490, 0x0aaf },
+    { 0x1a6d, 0xe0c6, 0x00b7 },
+    { 0x9c44, 0x4c2b, 0x6815 },
+    { 0xa294, 0x0e63, 0x622a },
+    { 0xeddd, 0x91a3, 0x2b4b },
+    { 0x1dc0, 0xde92, 0x5a96 },
+    { 0x33ff, 0x5ed7, 0xadb6 },
+    { 0x2ee7, 0xa9b3, 0x6663 },
+    { 0x3574, 0x2a12, 0x24a0 },
+    { 0xd351, 0x7d26, 0xe8de },
+    { 0xc044, 0xc0bc, 0xc309 },
+    { 0x2e53, 0x219e, 0x1d14 },
+    { 0x9db0, 0x29e2, 0xd549 },
+    { 0x3413, 0xca92, 0x5066 },
+    { 0xccd1, 0x7ae2, 0xff1d },
+    { 0x7de8, 0x0d42, 0x66af },
+    { 0xfcaf, 0x21cb, 0xfc3c },
+    { 0xbb53, 0x738b, 0xd6c7 },
+    { 0x755b, 0x8a18, 0x5125 },
+    { 0x0415, 0x177f, 0x0208 },
+    { 0x7a32, 0x050b, 0xefe9 },
+    { 0x2d47, 0x3233, 0x2d11 },
+    { 0xdd50, 0xa26c, 0xa0fc },
+    { 0xf89d, 0xe210, 0x4fc1 },
+    { 0x07b6, 0xa992, 0x6372 },
+    { 0x5140, 0xcd7e, 0xcfb1 },
+    { 0x4983, 0x98d4, 0x649e },
+    { 0xa732, 0x45de, 0x2d87 },
+    { 0x6d5e, 0x0e35, 0x2c02 },
+    { 0x39ca, 0x089c, 0x0279 },
+    { 0x6c74, 0xd110, 0x5715 },
+    { 0xa69a, 0x8eda, 0x5971 },
+    { 0x6914, 0x4b2a, 0xceb0 },
+    { 0xf577, 0xd3a5, 0x1750 },
+    { 0x9134, 0x02d4, 0x2f26 },
+    { 0x75b5, 0xe622, 0xb7e8 },
+    { 0xf8b3, 0x1577, 0x2b14 },
+    { 0xeed1, 0xe965, 0x0b0d },
+    { 0x8799, 0xd542, 0x0f0f },
+    { 0x0737, 0x98de, 0x469b },
+    { 0x090c, 0x4e2c, 0xd20f },
+    { 0xcf56, 0xec06, 0x0682 },
+    { 0xb40f, 0x45f9, 0x3695 },
+    { 0xac81, 0x2ff6, 0x926b },
+    { 0xc2e0, 0x737e, 0x97b9 },
+    { 0xb040, 0x6f51, 0xaa3f },
+    { 0x65c5, 0x34d2, 0x2b4d },
+};
+#define GOLDEN_TRACE_0 golden_trace_0
+#else
+#define GOLDEN_TRACE_0 NULL
+#endif
+#define GOLDEN_ENTRY_0 { 0, 0, 102, 0x7, 2000, 4000, 0xe714, 0x1fd7, 0x8e3a, 0x65c5, GOLDEN_TRACE_0 }
+#define GOLDEN_TRACE_1 NULL
+#define GOLDEN_ENTRY_1 { 0, 0, 102, 0x7, 4000, 0, 0x93c7, 0x8b17, 0x7603, 0x0000, GOLDEN_TRACE_1 }
+#define GOLDEN_TRACE_2 NULL
+#define GOLDEN_ENTRY_2 { 0, 0, 102, 0x7, 8000, 0, 0x0334, 0x6f81, 0x5ba5, 0x0000, GOLDEN_TRACE_2 }
+#define GOLDEN_TRACE_3 NULL
+#define GOLDEN_ENTRY_3 { 0, 0, 102, 0x7, 16000, 0, 0xa959, 0x8cb0, 0x2e7d, 0x0000, GOLDEN_TRACE_3 }
+#define GOLDEN_TRACE_4 NULL
+#define GOLDEN_ENTRY_4 { 0, 0, 102, 0x7, 32000, 0, 0xbd53, 0x8786, 0x1289, 0x0000, GOLDEN_TRACE_4 }
+#define GOLDEN_TRACE_5 NULL
+#define GOLDEN_ENTRY_5 { 0, 0, 102, 0x7, 64000, 0, 0x6d1b, 0xf44b, 0x0b73, 0x0000, GOLDEN_TRACE_5 }
+#define GOLDEN_TRACE_6 NULL
+#define GOLDEN_ENTRY_6 { 0, 0, 102, 0x7, 128000, 0, 0xcdb3, 0x464c, 0xc63c, 0x0000, GOLDEN_TRACE_6 }
+static const core_golden golden_table[] = {
+    GOLDEN_ENTRY_0,
+    GOLDEN_ENTRY_1,
+    GOLDEN_ENTRY_2,
+    GOLDEN_ENTRY_3,
+    GOLDEN_ENTRY_4,
+    GOLDEN_ENTRY_5,
+    GOLDEN_ENTRY_6,
+    { 0 }
+};
@@ -0,0 +1,90 @@
+/**
+ * @file      core_histogram.c
+ *
+ * @brief Fixed size log bucketed histogram of tick counts
+ */
+
+#include "core_histogram.h"
+
+#define HIST_SUB_COUNT (1u << HIST_SUB_BITS)
+
+/* Function : hist_index
+        Bucket index of a value. Values below HIST_SUB_COUNT get a bucket each,
+   larger values are indexed by their top HIST_SUB_BITS + 1 bits.
+*/
+static ee_u32
+hist_index(ee_u32 value)
+{
+    ee_u32 msb;
+
+    if (value < HIST_SUB_COUNT)
+        return value;
+    msb = 31 - __builtin_clz(value);
+    return ((msb - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+           + ((value >> (msb - HIST_SUB_BITS)) & (HIST_SUB_COUNT - 1));
+}
+
+/* Function : hist_value
+        Lowest value that falls in a bucket, the inverse of <hist_index>.
+*/
+static ee_u32
+hist_value(ee_u32 index)
+{
+    ee_u32 shift;
+
+    if (index < HIST_SUB_COUNT)
+        return index;
+    shift = (index >> HIST_SUB_BITS) - 1;
+    return (HIST_SUB_COUNT + (index & (HIST_SUB_COUNT - 1))) << shift;
+}
+
+void
+core_histogram_reset(core_histogram *h)
+{
+    ee_u32 i;
+
+    for (i = 0; i < HIST_BUCKETS; i++)
+        h->count[i] = 0;
+    h->samples = 0;
+    h->min     = 0xffffffff;
+    h->max     = 0;
+}
+
+void
+core_histogram_add(core_histogram *h, ee_u32 value)
+{
+    h->count[hist_index(value)]++;
+    h->samples++;
+    if (value < h->min)
+        h->min = value;
+    if (value > h->max)
+        h->max = value;
+}
+
+/* Function : core_histogram_percentile
+        Value below which <percent> of the samples fall, to bucket precision
+   and clamped to the exact min and max. Returns 0 for an empty histogram.
+*/
+ee_u32
+core_histogram_percentile(const core_histogram *h, ee_u32 percent)
+{
+    ee_u32 i, seen = 0, rank, value;
+
+    if (h->samples == 0)
+        return 0;
+    rank = (ee_u32)(((ee_u64)h->samples * percent + 99) / 100);
+    if (rank == 0)
+        rank = 1;
+    for (i = 0; i < HIST_BUCKETS; i++)
+    {
+        seen += h->count[i];
+        if (seen >= rank)
+            break;
+    }
+    value = hist_value(i);
+    if (value < h->min)
+        value = h->min;
+    if (value > h->max)
+        value = h->max;
+    return value;
+}
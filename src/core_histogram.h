@@ -0,0 +1,33 @@
+/**
+ * @file      core_histogram.h
+ *
+ * @brief Fixed size log bucketed histogram of tick counts
+ */
+
+/* Topic : Description
+        Values are bucketed by power of two, with each power of two split
+   into 2^HIST_SUB_BITS linear sub-buckets, so any value is recorded to within
+   1/16th of itself. Adding a value is a handful of instructions and never
+   allocates, so it can be used inside the timed loop.
+*/
+#ifndef CORE_HISTOGRAM_H
+#define CORE_HISTOGRAM_H
+
+#include "core_portme.h"
+
+#define HIST_SUB_BITS 4
+#define HIST_BUCKETS  ((32 - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+
+typedef struct CORE_HISTOGRAM_S
+{
+    ee_u32 count[HIST_BUCKETS];
+    ee_u32 samples;
+    ee_u32 min;
+    ee_u32 max;
+} core_histogram;
+
+void   core_histogram_reset(core_histogram *h);
+void   core_histogram_add(core_histogram *h, ee_u32 value);
+ee_u32 core_histogram_percentile(const core_histogram *h, ee_u32 percent);
+
+#endif /* CORE_HISTOGRAM_H */
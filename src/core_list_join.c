@@ -83,22 +83,45 @@ calc_func(ee_s16 *pdata, core_results *res)
             = ((data >> 3)
                & 0xf);       /* bits 3-6 is specific data for the operation */
         dtype |= dtype << 4; /* replicate the lower 4 bits to get an 8b value */
+#if CORE_KERNEL_TIMING
+        ee_u32 t0 = barebones_clock_raw();
+#endif
         switch (flag)
         {
             case 0:
                 if (dtype < 0x22) /* set min period for bit corruption */
                     dtype = 0x22;
+#if CORE_DIAGNOSE
+                if (res->crcstate == 0)
+                {
+                    res->diag_state_step = dtype;
+                    res->diag_state_crc  = res->crc;
+                }
+#endif
                 retval = core_bench_state(res->size,
                                           res->memblock[3],
                                           res->seed1,
                                           res->seed2,
                                           dtype,
                                           res->crc);
+#if CORE_KERNEL_TIMING
+                res->kernel_ticks[IDX_STATE] += barebones_clock_raw() - t0;
+#endif
                 if (res->crcstate == 0)
                     res->crcstate = retval;
                 break;
             case 1:
+#if CORE_DIAGNOSE
+                if (res->crcmatrix == 0)
+                {
+                    res->diag_matrix_seed = dtype;
+                    res->diag_matrix_crc  = res->crc;
+                }
+#endif
                 retval = core_bench_matrix(&(res->mat), dtype, res->crc);
+#if CORE_KERNEL_TIMING
+                res->kernel_ticks[IDX_MATRIX] += barebones_clock_raw() - t0;
+#endif
                 if (res->crcmatrix == 0)
                     res->crcmatrix = retval;
                 break;
@@ -148,33 +171,33 @@ copy_info(list_data *to, list_data *from)
     to->idx    = from->idx;
 }
 
-/* Benchmark for linked list:
+/* Benchmark for linked list, in steps:
         - Try to find multiple data items.
         - List sort
         - Operate on data from list (crc)
         - Single remove/reinsert
-        * At the end of this function, the list is back to original state
+        * At the end of the last step, the list is back to original state
 */
-ee_u16
-core_bench_list(core_results *res, ee_s16 finder_idx)
+
+/* find <find_num> values in the list, and change the list each time
+ * (reverse and cache if value found) */
+static inline void
+list_bench_find(list_bench *b, core_results *res, ee_s16 finder_idx)
 {
-    ee_u16     retval = 0;
     ee_u16     found = 0, missed = 0;
     list_head *list     = res->list;
     ee_s16     find_num = res->seed3;
     list_head *this_find;
-    list_head *finder, *remover;
-    list_data  info;
+    list_head *finder;
+    ee_u16     retval = 0;
     ee_s16     i;
 
-    info.idx = finder_idx;
-    /* find <find_num> values in the list, and change the list each time
-     * (reverse and cache if value found) */
+    b->info.idx = finder_idx;
     for (i = 0; i < find_num; i++)
     {
-        info.data16 = (i & 0xff);
-        this_find   = core_list_find(list, &info);
-        list        = core_list_reverse(list);
+        b->info.data16 = (i & 0xff);
+        this_find      = core_list_find(list, &b->info);
+        list           = core_list_reverse(list);
         if (this_find == NULL)
         {
             missed++;
@@ -194,45 +217,111 @@ core_bench_list(core_results *res, ee_s16 finder_idx)
                 list->next      = finder;
             }
         }
-        if (info.idx >= 0)
-            info.idx++;
+        if (b->info.idx >= 0)
+            b->info.idx++;
 #if CORE_DEBUG
         ee_printf("List find %d: [%d,%d,%d]\n", i, retval, missed, found);
 #endif
     }
-    retval += found * 4 - missed;
-    /* sort the list by data content and remove one item*/
+    b->list   = list;
+    b->retval = retval + found * 4 - missed;
+}
+
+/* sort the list by data content */
+static inline void
+list_bench_sort(list_bench *b, core_results *res, ee_s16 finder_idx)
+{
     if (finder_idx > 0)
-        list = core_list_mergesort(list, cmp_complex, res);
-    remover = core_list_remove(list->next);
-    /* CRC data content of list from location of index N forward, and then undo
-     * remove */
-    finder = core_list_find(list, &info);
+        b->list = core_list_mergesort(b->list, cmp_complex, res);
+}
+
+/* remove one item, and CRC data content of list from location of index N
+ * forward */
+static inline void
+list_bench_remove(list_bench *b)
+{
+    list_head *finder;
+
+    b->remover = core_list_remove(b->list->next);
+    finder     = core_list_find(b->list, &b->info);
     if (!finder)
-        finder = list->next;
+        finder = b->list->next;
     while (finder)
     {
-        retval = crc16(list->info->data16, retval);
-        finder = finder->next;
+        b->retval = crc16(b->list->info->data16, b->retval);
+        finder    = finder->next;
     }
 #if CORE_DEBUG
-    ee_printf("List sort 1: %04x\n", retval);
+    ee_printf("List sort 1: %04x\n", b->retval);
 #endif
-    remover = core_list_undo_remove(remover, list->next);
-    /* sort the list by index, in effect returning the list to original state */
-    list = core_list_mergesort(list, cmp_idx, NULL);
-    /* CRC data content of list */
-    finder = list->next;
+}
+
+static inline void
+list_bench_undo_remove(list_bench *b)
+{
+    b->remover = core_list_undo_remove(b->remover, b->list->next);
+}
+
+/* sort the list by index, in effect returning the list to original state,
+ * and CRC data content of list */
+static inline void
+list_bench_restore(list_bench *b)
+{
+    list_head *finder;
+
+    b->list = core_list_mergesort(b->list, cmp_idx, NULL);
+    finder  = b->list->next;
     while (finder)
     {
-        retval = crc16(list->info->data16, retval);
-        finder = finder->next;
+        b->retval = crc16(b->list->info->data16, b->retval);
+        finder    = finder->next;
     }
 #if CORE_DEBUG
-    ee_printf("List sort 2: %04x\n", retval);
+    ee_printf("List sort 2: %04x\n", b->retval);
 #endif
-    return retval;
 }
+
+ee_u16
+core_bench_list(core_results *res, ee_s16 finder_idx)
+{
+    list_bench b;
+
+    list_bench_find(&b, res, finder_idx);
+    list_bench_sort(&b, res, finder_idx);
+    list_bench_remove(&b);
+    list_bench_undo_remove(&b);
+    list_bench_restore(&b);
+    return b.retval;
+}
+
+#if CORE_DIAGNOSE
+/* Function: core_list_bench_step
+        Run step <step> of <core_bench_list> on <b>, starting from step 0, so
+        a replay can compare the lists between steps.
+*/
+void
+core_list_bench_step(list_bench *b, int step, core_results *res, ee_s16 finder_idx)
+{
+    switch (step)
+    {
+        case 0:
+            list_bench_find(b, res, finder_idx);
+            break;
+        case 1:
+            list_bench_sort(b, res, finder_idx);
+            break;
+        case 2:
+            list_bench_remove(b);
+            break;
+        case 3:
+            list_bench_undo_remove(b);
+            break;
+        default:
+            list_bench_restore(b);
+            break;
+    }
+}
+#endif
 /* Function: core_list_init
         Initialize list with data.
 
@@ -0,0 +1,153 @@
+/**
+ * @file      core_lockstep.c
+ *
+ * @brief Cross checking of per iteration CRCs between contexts
+ */
+
+#include "coremark.h"
+#include "core_lockstep.h"
+
+#if CORE_LOCKSTEP
+
+/* Function : core_lockstep_start
+        Empty every ring and pair each context with the next one, before the
+   contexts of a run are started. A single context has no peer.
+*/
+void
+core_lockstep_start(core_results *results, ee_u32 num_contexts)
+{
+    core_lockstep *ls;
+    ee_u32         i;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        ls = results[i].lockstep;
+        atomic_store(&ls->head, 0);
+        atomic_store(&ls->tail, 0);
+        ls->peer_index = (i + 1) % num_contexts;
+        ls->peer       = num_contexts > 1 ? results[ls->peer_index].lockstep
+                                          : NULL;
+        ls->done       = 0;
+        ls->compared   = 0;
+        ls->unchecked  = 0;
+        ls->dropped    = 0;
+        ls->diverged   = 0;
+    }
+}
+
+/* Function : drain_peer
+        Compare every entry the peer has published for an iteration this
+   context has also run. Entries the peer is ahead on stay in its ring.
+*/
+static void
+drain_peer(core_lockstep *ls)
+{
+    core_lockstep *      peer = ls->peer;
+    core_lockstep_entry *e;
+    unsigned int         head, tail;
+
+    tail = atomic_load_explicit(&peer->tail, memory_order_relaxed);
+    head = atomic_load_explicit(&peer->head, memory_order_acquire);
+    for (; tail != head; tail++)
+    {
+        e = &peer->ring[tail & (LOCKSTEP_DEPTH - 1)];
+        if (e->iteration >= ls->done)
+            break;
+        if (ls->done - e->iteration > LOCKSTEP_DEPTH)
+            ls->unchecked++;
+        else
+        {
+            ls->compared++;
+            if (e->crc != ls->history[e->iteration & (LOCKSTEP_DEPTH - 1)]
+                && ls->diverged == 0)
+                ls->diverged = e->iteration + 1;
+        }
+    }
+    atomic_store_explicit(&peer->tail, tail, memory_order_release);
+}
+
+/* Function : core_lockstep_step
+        Publish the CRC of the iteration just run, then check what the peer
+   has published so far.
+*/
+void
+core_lockstep_step(core_lockstep *ls, ee_u32 iteration, ee_u16 crc)
+{
+    core_lockstep_entry *e;
+    unsigned int         head, tail;
+
+    ls->history[iteration & (LOCKSTEP_DEPTH - 1)] = crc;
+    ls->done                                      = iteration + 1;
+    if (ls->peer == NULL)
+        return;
+
+    head = atomic_load_explicit(&ls->head, memory_order_relaxed);
+    tail = atomic_load_explicit(&ls->tail, memory_order_acquire);
+    if (head - tail < LOCKSTEP_DEPTH)
+    {
+        e            = &ls->ring[head & (LOCKSTEP_DEPTH - 1)];
+        e->iteration = iteration;
+        e->crc       = crc;
+        atomic_store_explicit(&ls->head, head + 1, memory_order_release);
+    }
+    else
+        ls->dropped++;
+    drain_peer(ls);
+}
+
+/* Function : core_lockstep_report
+        Check what the peers published after each context finished, then
+   print how many of its peer's iterations each context cross checked, and
+   the first one that differed.
+
+        Returns:
+        Number of contexts that saw a difference or checked less than
+   LOCKSTEP_MIN_COVERAGE percent of their peer's iterations.
+*/
+ee_s16
+core_lockstep_report(core_results *results, ee_u32 num_contexts)
+{
+    core_lockstep *ls;
+    ee_s16         errors = 0;
+    ee_u32         i, coverage;
+
+    if (num_contexts < 2)
+        return 0;
+    for (i = 0; i < num_contexts; i++)
+        drain_peer(results[i].lockstep);
+    for (i = 0; i < num_contexts; i++)
+    {
+        ls       = results[i].lockstep;
+        coverage = ls->peer->done
+                       ? (ee_u32)((ee_u64)ls->compared * 100 / ls->peer->done)
+                       : 100;
+        ee_printf("[%u]lockstep       : %lu of %lu checked (%lu%%), %lu unchecked, %lu dropped by context %u\n",
+                  i,
+                  (unsigned long)ls->compared,
+                  (unsigned long)ls->peer->done,
+                  (unsigned long)coverage,
+                  (unsigned long)ls->unchecked,
+                  (unsigned long)ls->peer->dropped,
+                  ls->peer_index);
+        if (coverage < LOCKSTEP_MIN_COVERAGE)
+        {
+            ee_printf("[%u]ERROR! lockstep checked %lu%% of context %u, below %d%%\n",
+                      i,
+                      (unsigned long)coverage,
+                      ls->peer_index,
+                      LOCKSTEP_MIN_COVERAGE);
+        }
+        if (ls->diverged)
+        {
+            ee_printf("[%u]ERROR! crc differs from context %u in iteration %lu\n",
+                      i,
+                      ls->peer_index,
+                      (unsigned long)(ls->diverged - 1));
+        }
+        if (coverage < LOCKSTEP_MIN_COVERAGE || ls->diverged)
+            errors++;
+    }
+    return errors;
+}
+
+#endif
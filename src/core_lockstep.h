@@ -0,0 +1,66 @@
+/**
+ * @file      core_lockstep.h
+ *
+ * @brief Cross checking of per iteration CRCs between contexts
+ */
+
+/* Topic : Description
+        All contexts run the same seeds, so the running CRC after every
+   iteration has to match between them. Each context publishes its CRC after
+   every iteration into its own single producer, single consumer ring, and
+   drains the ring of the next context, comparing each entry against its own
+   CRC for the same iteration. Neither side ever waits: a full ring drops the
+   entry, and an entry older than the local history is counted as unchecked.
+   This finds silent corruption on one core without any reference CRCs.
+
+        Contexts that drift more than LOCKSTEP_DEPTH iterations apart lose
+   entries that way, so <core_lockstep_report> also counts a context that
+   checked less than LOCKSTEP_MIN_COVERAGE percent of its peer's iterations
+   as an error, rather than passing a run that was barely cross checked.
+*/
+#ifndef CORE_LOCKSTEP_H
+#define CORE_LOCKSTEP_H
+
+#include "core_portme.h"
+#include <stdatomic.h>
+
+#ifndef LOCKSTEP_DEPTH
+#define LOCKSTEP_DEPTH 64 /* Ring and history entries, a power of two */
+#endif
+#if (LOCKSTEP_DEPTH & (LOCKSTEP_DEPTH - 1))
+#error "LOCKSTEP_DEPTH must be a power of two"
+#endif
+#ifndef LOCKSTEP_MIN_COVERAGE
+#define LOCKSTEP_MIN_COVERAGE 90 /* Percent of the peer's iterations checked */
+#endif
+
+typedef struct CORE_LOCKSTEP_ENTRY_S
+{
+    ee_u32 iteration;
+    ee_u16 crc;
+} core_lockstep_entry;
+
+typedef struct CORE_LOCKSTEP_S
+{
+    /* ring, written by this context and read by the previous one */
+    atomic_uint         head; /* Entries published */
+    atomic_uint         tail; /* Entries consumed */
+    core_lockstep_entry ring[LOCKSTEP_DEPTH];
+    /* consumer side, private to this context */
+    struct CORE_LOCKSTEP_S *peer;  /* Context whose ring this one drains */
+    ee_u32 peer_index;
+    ee_u16 history[LOCKSTEP_DEPTH]; /* Own CRCs, by iteration */
+    ee_u32 done;                    /* Own iterations published */
+    ee_u32 compared;                /* Peer entries checked */
+    ee_u32 unchecked;               /* Peer entries older than history */
+    ee_u32 dropped;                 /* Own entries lost to a full ring */
+    ee_u32 diverged;                /* 1 + first iteration that differed */
+} core_lockstep;
+
+struct RESULTS_S;
+
+void   core_lockstep_start(struct RESULTS_S *results, ee_u32 num_contexts);
+void   core_lockstep_step(core_lockstep *ls, ee_u32 iteration, ee_u16 crc);
+ee_s16 core_lockstep_report(struct RESULTS_S *results, ee_u32 num_contexts);
+
+#endif /* CORE_LOCKSTEP_H */
@@ -0,0 +1,153 @@
+/**
+ * @file      core_log.c
+ *
+ * @brief Lock-free multi producer console ring
+ */
+
+#include "coremark.h"
+#include "core_log.h"
+#include <stdatomic.h>
+
+#define LOG_READY 0x80000000u
+#define LOG_WORDS (LOG_RING_BYTES / 4)
+
+#if (LOG_RING_BYTES & (LOG_RING_BYTES - 1)) || LOG_RING_BYTES < 64
+#error "LOG_RING_BYTES must be a power of two of at least 64"
+#endif
+
+static struct
+{
+    atomic_uint head;    /* Bytes reserved */
+    atomic_uint tail;    /* Bytes released by the consumer */
+    atomic_uint dropped; /* Bytes that did not fit */
+    atomic_uint ring[LOG_WORDS];
+    /* consumer side */
+    ee_u32 pos;  /* Byte of the record being sent */
+    ee_u32 left; /* Bytes of it still to send, 0 between records */
+} core_log;
+
+#define LOG_BYTES ((ee_u8 *)core_log.ring)
+#define LOG_HEADER(at) (&core_log.ring[((at) % LOG_RING_BYTES) / 4])
+
+/* Function : core_log_write
+        Add <len> bytes of <text> as one record, from any context.
+
+        Returns:
+        <len>, or 0 when the ring had no room and the text was dropped.
+*/
+ee_u32
+core_log_write(const char *text, ee_u32 len)
+{
+    ee_u32   need = 4 + ((len + 3) & ~3u), at, i;
+    unsigned head, tail;
+
+    if (len == 0)
+        return 0;
+    head = atomic_load_explicit(&core_log.head, memory_order_relaxed);
+    do
+    {
+        tail = atomic_load_explicit(&core_log.tail, memory_order_acquire);
+        if (need > LOG_RING_BYTES - (head - tail))
+        {
+            atomic_fetch_add_explicit(&core_log.dropped, len, memory_order_relaxed);
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&core_log.head,
+                                                    &head,
+                                                    head + need,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
+    for (i = 0, at = head + 4; i < len; i++, at++)
+        LOG_BYTES[at % LOG_RING_BYTES] = text[i];
+    atomic_store_explicit(LOG_HEADER(head), len | LOG_READY, memory_order_release);
+    portable_log_kick();
+    return len;
+}
+
+/* Function : core_log_next
+        Consumer only. Find the next piece of text to send.
+
+        Returns:
+        Its length, with <piece> pointing at it, or 0 when the next record is
+        not ready yet.
+*/
+ee_u32
+core_log_next(const char **piece)
+{
+    unsigned tail, header;
+    ee_u32   at, len;
+
+    if (core_log.left == 0)
+    {
+        tail = atomic_load_explicit(&core_log.tail, memory_order_relaxed);
+        if (tail == atomic_load_explicit(&core_log.head, memory_order_acquire))
+            return 0;
+        header = atomic_load_explicit(LOG_HEADER(tail), memory_order_acquire);
+        if (!(header & LOG_READY))
+            return 0;
+        core_log.pos  = tail + 4;
+        core_log.left = header & ~LOG_READY;
+    }
+    at  = core_log.pos % LOG_RING_BYTES;
+    len = LOG_RING_BYTES - at;
+    if (len > core_log.left)
+        len = core_log.left;
+    *piece = (const char *)&LOG_BYTES[at];
+    return len;
+}
+
+/* Function : core_log_done
+        Consumer only. The <len> bytes from <core_log_next> have been sent.
+   A record that is all sent is zeroed and its room given back.
+*/
+void
+core_log_done(ee_u32 len)
+{
+    unsigned tail;
+    ee_u32   need, i;
+
+    core_log.pos += len;
+    core_log.left -= len;
+    if (core_log.left)
+        return;
+    tail = atomic_load_explicit(&core_log.tail, memory_order_relaxed);
+    need = (core_log.pos - tail + 3) & ~3u;
+    for (i = 0; i < need; i += 4)
+        atomic_store_explicit(LOG_HEADER(tail + i), 0, memory_order_relaxed);
+    atomic_store_explicit(&core_log.tail, tail + need, memory_order_release);
+}
+
+/* Function : core_log_pending
+        Returns:
+        Bytes of the ring in use, headers included.
+*/
+ee_u32
+core_log_pending(void)
+{
+    return atomic_load_explicit(&core_log.head, memory_order_acquire)
+           - atomic_load_explicit(&core_log.tail, memory_order_acquire);
+}
+
+/* Function : core_log_dropped
+        Returns:
+        Bytes dropped since the start because the ring was full.
+*/
+ee_u32
+core_log_dropped(void)
+{
+    return atomic_load_explicit(&core_log.dropped, memory_order_relaxed);
+}
+
+/* Function : core_log_flush
+        Wait for the consumer to send everything written so far, before the
+   clock changes or the program ends. Not for the timed path.
+*/
+void
+core_log_flush(void)
+{
+    unsigned head = atomic_load_explicit(&core_log.head, memory_order_acquire);
+
+    portable_log_kick();
+    while ((int)(head - atomic_load_explicit(&core_log.tail, memory_order_acquire)) > 0)
+        ;
+}
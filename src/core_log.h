@@ -0,0 +1,43 @@
+/**
+ * @file      core_log.h
+ *
+ * @brief Lock-free multi producer console ring
+ */
+
+/* Topic : Description
+        With CORE_LOG, <ee_printf> formats into its own buffer and hands the
+   text to <core_log_write>, which never waits: it reserves room in the ring
+   with a compare and swap, copies the text in and marks the record ready.
+   When the ring is full the text is dropped and counted instead. Any core,
+   thread or interrupt can write.
+
+        A record is a header word, holding the length and a ready bit,
+   followed by the text padded to a word. Records come out in the order
+   their room was reserved. A single consumer, owned by the port, takes
+   them out with <core_log_next> and <core_log_done>, a contiguous piece at
+   a time so the pieces can be handed to DMA, and zeroes what it has sent
+   so stale text never looks like a ready header.
+
+        The port provides the consumer, and <portable_log_kick>, which
+   producers call after every record to wake it.
+*/
+#ifndef CORE_LOG_H
+#define CORE_LOG_H
+
+#include "core_portme.h"
+
+#ifndef LOG_RING_BYTES
+#define LOG_RING_BYTES 8192 /* A power of two */
+#endif
+
+ee_u32 core_log_write(const char *text, ee_u32 len);
+ee_u32 core_log_next(const char **piece);
+void   core_log_done(ee_u32 len);
+ee_u32 core_log_pending(void);
+ee_u32 core_log_dropped(void);
+void   core_log_flush(void);
+
+/* Port side: wake the consumer */
+void portable_log_kick(void);
+
+#endif /* CORE_LOG_H */
@@ -20,6 +20,66 @@ Original Author: Shay Gal-on
 	This file contains the framework to acquire a block of memory, seed initial parameters, tun t he benchmark and report the results.
 */
 #include "coremark.h"
+#include "core_golden.h"
+#include <string.h>
+#if CORE_ITERATION_HISTOGRAM
+#include "core_histogram.h"
+#endif
+#if CORE_LOCKSTEP
+#include "core_lockstep.h"
+#endif
+#if CORE_DIAGNOSE
+#include "core_diag.h"
+#endif
+#if CORE_CRASH_RECORD
+#include "core_crash.h"
+#endif
+#if CORE_THERMAL
+#include "core_thermal.h"
+#endif
+#if CORE_LOG
+#include "core_log.h"
+#endif
+#if CORE_RECORD
+#include "core_record.h"
+#endif
+#if CORE_TELEMETRY
+#include "core_telemetry.h"
+#endif
+#if CORE_CLOCK_MEASURE
+#include "core_clock.h"
+#endif
+#if CORE_BASELINE
+#include "core_baseline.h"
+#endif
+
+#if CORE_ITERATION_HISTOGRAM
+/* Latency histogram of each context, static so nothing is allocated for it */
+static core_histogram iteration_hist[MULTITHREAD];
+#endif
+
+#if CORE_ITERATION_CHECK
+volatile ee_u32 core_check_abort;
+
+/* Function: check_iteration
+	Compare the CRCs of the iteration just run with the expected ones. The
+	matrix and state results feed the running CRC, so they are checked
+	first to blame the kernel that went wrong.
+
+	Returns:
+	ID of the kernel that diverged, or 0.
+*/
+static ee_u32 check_iteration(core_results *res, const core_golden_iter *expect)
+{
+    if (res->crcmatrix != expect->crcmatrix)
+        return ID_MATRIX;
+    if (res->crcstate != expect->crcstate)
+        return ID_STATE;
+    if (res->crc != expect->crc)
+        return ID_LIST;
+    return 0;
+}
+#endif
 
 /* Function: iterate
 	Run the benchmark for a specified number of iterations.
@@ -29,6 +89,11 @@ Original Author: Shay Gal-on
 		a - Initialize the data block for the algorithm.
 		b - Execute the algorithm N times.
 
+	With CORE_ITERATION_CHECK, each iteration that has an entry in
+	res->check starts its matrix and state CRCs afresh so they can be
+	compared against the trace. The first result of the run is put back
+	after each, as the reports expect.
+
 	Returns:
 	NULL.
 */
@@ -41,23 +106,455 @@ void *iterate(void *pres)
     ee_u16 crc;
     core_results *res = (core_results *)pres;
     ee_u32 iterations = res->iterations;
+#if (WORK_STEALING_CHUNK > 0)
+    if (res->sched)
+        return core_sched_worker_run(res);
+#endif
     res->crc = 0;
     res->crclist = 0;
     res->crcmatrix = 0;
     res->crcstate = 0;
+    res->start_ticks = barebones_clock();
+#if CORE_KERNEL_TIMING
+    for (i = 0; i < NUM_ALGORITHMS; i++)
+        res->kernel_ticks[i] = 0;
+#endif
+#if CORE_ITERATION_HISTOGRAM
+    core_histogram *hist = res->hist;
+    ee_u32 last, now;
+    if (hist)
+        core_histogram_reset(hist);
+    last = barebones_clock_raw();
+#endif
+#if CORE_ITERATION_CHECK
+    const core_golden_iter *check = res->check;
+    ee_u16 crcmatrix = 0, crcstate = 0;
+    res->fail_kernel = 0;
+    res->fail_iteration = iterations;
+#endif
 
     for (i = 0; i < iterations; i++)
     {
+#if CORE_CRASH_RECORD
+        if (res->crash_iteration)
+            *res->crash_iteration = i;
+#endif
+#if CORE_THERMAL
+        /* held time is not the context's, and not an iteration's latency */
+        if (core_thermal_run.hold)
+        {
+            /* a held context is not hung, so the watchdog leaves it alone */
+#if CORE_CRASH_RECORD
+            if (res->crash_iteration)
+                *res->crash_iteration = CRASH_IDLE;
+#endif
+            res->start_ticks += core_thermal_wait();
+#if CORE_CRASH_RECORD
+            if (res->crash_iteration)
+                *res->crash_iteration = i;
+#endif
+#if CORE_ITERATION_HISTOGRAM
+            last = barebones_clock_raw();
+#endif
+        }
+        if (core_thermal_run.abort)
+            break;
+#endif
+#if CORE_ITERATION_CHECK
+        if (core_check_abort)
+        {
+            res->fail_iteration = i;
+            break;
+        }
+        if (check && i < res->check_iterations)
+        {
+            res->crcmatrix = 0;
+            res->crcstate = 0;
+#if CORE_DIAGNOSE
+            if (res->diag_block)
+            {
+                memcpy(res->diag_block, res->memblock[0], res->diag_size);
+                res->diag_crc = res->crc;
+            }
+#endif
+        }
+#endif
+#if CORE_KERNEL_TIMING
+        ee_u32 list_t0 = barebones_clock_raw();
+        CORE_TICKS nested = res->kernel_ticks[IDX_MATRIX] + res->kernel_ticks[IDX_STATE];
+#endif
         crc = core_bench_list(res, 1);
         res->crc = crcu16(crc, res->crc);
         crc = core_bench_list(res, -1);
         res->crc = crcu16(crc, res->crc);
+#if CORE_KERNEL_TIMING
+        /* matrix and state run from inside the list kernel */
+        res->kernel_ticks[IDX_LIST] += barebones_clock_raw() - list_t0
+                                       - (res->kernel_ticks[IDX_MATRIX] + res->kernel_ticks[IDX_STATE] - nested);
+#endif
         if (i == 0)
             res->crclist = res->crc;
+#if CORE_ITERATION_CHECK
+        if (check && i < res->check_iterations)
+        {
+            res->fail_kernel = check_iteration(res, &check[i]);
+            if (crcmatrix == 0)
+                crcmatrix = res->crcmatrix;
+            if (crcstate == 0)
+                crcstate = res->crcstate;
+            res->crcmatrix = crcmatrix;
+            res->crcstate = crcstate;
+            if (res->fail_kernel)
+            {
+                res->fail_iteration = i;
+                core_check_abort = 1;
+                break;
+            }
+        }
+#endif
+#if CORE_LOCKSTEP
+        if (res->lockstep)
+            core_lockstep_step(res->lockstep, i, res->crc);
+#endif
+#if CORE_ITERATION_HISTOGRAM
+        if (hist)
+        {
+            now = barebones_clock_raw();
+            core_histogram_add(hist, now - last);
+            last = now;
+        }
+#endif
     }
+    res->stop_ticks = barebones_clock();
+#if CORE_CRASH_RECORD
+    if (res->crash_iteration)
+        *res->crash_iteration = CRASH_IDLE;
+#endif
     return NULL;
 }
 
+#if CORE_KERNEL_TIMING || CORE_ITERATION_CHECK
+static const char *kernel_name[NUM_ALGORITHMS] = {"list", "matrix", "state"};
+#endif
+
+#if CORE_ITERATION_CHECK
+/* Function: report_divergence
+	Print where each context that diverged from the trace failed, how long
+	after its start that was seen, and where the others were stopped.
+
+	Returns:
+	Number of contexts that diverged.
+*/
+static ee_s16 report_divergence(core_results *results, ee_u32 num_contexts)
+{
+    ee_s16 errors = 0;
+    ee_u32 i, k;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        if (results[i].fail_kernel)
+        {
+            for (k = 0; (1u << k) != results[i].fail_kernel; k++)
+                ;
+            ee_printf("[%u]ERROR! %s crc diverged in iteration %lu, detected after %llu ticks\n", i,
+                      kernel_name[k], (unsigned long)results[i].fail_iteration,
+                      (unsigned long long)(results[i].stop_ticks - results[i].start_ticks));
+#if CORE_TELEMETRY
+            core_telemetry_error(i, k, results[i].fail_iteration, 0, 0);
+#endif
+            errors++;
+        }
+        else if (results[i].fail_iteration < results[i].iterations)
+        {
+            ee_printf("[%u]stopped in iteration %lu\n", i, (unsigned long)results[i].fail_iteration);
+        }
+    }
+    return errors;
+}
+#endif
+
+#if CORE_KERNEL_TIMING
+
+/* Function: report_kernel_ticks
+	Print the ticks spent in each kernel, per context and in total. What is
+	left of the run, the loop, CRCs, checks and the timing itself, is
+	reported as other.
+*/
+static void report_kernel_ticks(core_results *results, ee_u32 num_contexts)
+{
+    CORE_TICKS total[NUM_ALGORITHMS] = {0};
+    CORE_TICKS run, in_kernels;
+    ee_u32 i, k;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        run = results[i].stop_ticks - results[i].start_ticks;
+        in_kernels = 0;
+        for (k = 0; k < NUM_ALGORITHMS; k++)
+            in_kernels += results[i].kernel_ticks[k];
+        if (run == 0 || in_kernels > run)
+            continue;
+        for (k = 0; k < NUM_ALGORITHMS; k++)
+        {
+            total[k] += results[i].kernel_ticks[k];
+            if (results[i].execs & (1 << k))
+                ee_printf("[%u]%-6s ticks    : %llu (%u%%)\n", i, kernel_name[k],
+                          (unsigned long long)results[i].kernel_ticks[k],
+                          (unsigned)(results[i].kernel_ticks[k] * 100 / run));
+        }
+        ee_printf("[%u]other  ticks    : %llu (%u%%)\n", i, (unsigned long long)(run - in_kernels),
+                  (unsigned)((run - in_kernels) * 100 / run));
+    }
+    if (num_contexts > 1)
+        for (k = 0; k < NUM_ALGORITHMS; k++)
+            if (results[0].execs & (1 << k))
+                ee_printf("%-6s ticks total : %llu\n", kernel_name[k], (unsigned long long)total[k]);
+}
+#endif
+
+#if CORE_ITERATION_HISTOGRAM
+/* Function: report_iteration_latency
+	Print the spread of per iteration latency seen by each context.
+*/
+static void report_iteration_latency(core_results *results, ee_u32 num_contexts)
+{
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        core_histogram *h = results[i].hist;
+        if (h == NULL || h->samples == 0)
+            continue;
+        ee_printf("[%u]iteration ticks: min %lu p50 %lu p99 %lu max %lu\n", i,
+                  (unsigned long)h->min,
+                  (unsigned long)core_histogram_percentile(h, 50),
+                  (unsigned long)core_histogram_percentile(h, 99),
+                  (unsigned long)h->max);
+    }
+}
+#endif
+
+/* Function: run_contexts
+	Run <iterate> for the given number of iterations on each context in
+	parallel. Each context timestamps its own start and stop, after the
+	port's start barrier, so launch and logging are not timed.
+
+	Returns:
+	Ticks from the first context starting to the last one finishing.
+*/
+CORE_TICKS run_contexts(core_results *results, ee_u32 num_contexts, ee_u32 iterations)
+{
+    CORE_TICKS first_start, last_stop;
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+        results[i].iterations = iterations;
+#if CORE_ITERATION_CHECK
+    core_check_abort = 0;
+#endif
+#if CORE_LOCKSTEP
+    if (results[0].lockstep)
+        core_lockstep_start(results, num_contexts);
+#endif
+#if (MULTITHREAD > 1)
+    if (num_contexts > 1)
+    {
+        for (i = 0; i < num_contexts; i++)
+        {
+            core_start_parallel(i, &results[i]);
+        }
+        for (i = 0; i < num_contexts; i++)
+        {
+            core_end_parallel(i);
+        }
+    }
+    else
+#endif
+    iterate(&results[0]);
+    first_start = results[0].start_ticks;
+    last_stop = results[0].stop_ticks;
+    for (i = 1; i < num_contexts; i++)
+    {
+        if (results[i].start_ticks < first_start)
+            first_start = results[i].start_ticks;
+        if (results[i].stop_ticks > last_stop)
+            last_stop = results[i].stop_ticks;
+    }
+    return last_stop - first_start;
+}
+
+/* Function: aggregate_rate
+	Sum over all contexts of the iterations per second each achieved in its
+	own timed window.
+*/
+secs_ret aggregate_rate(core_results *results, ee_u32 num_contexts)
+{
+    secs_ret rate = 0, secs;
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        secs = time_in_secs(results[i].stop_ticks - results[i].start_ticks);
+        if (secs > 0)
+            rate += results[i].iterations / secs;
+    }
+    return rate;
+}
+
+/* Function: report_context_timing
+	Print each context's own run time and the skew between their starts.
+*/
+static void report_context_timing(core_results *results, ee_u32 num_contexts)
+{
+    CORE_TICKS first_start = results[0].start_ticks, last_start = results[0].start_ticks;
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        ee_printf("[%u]ticks          : %llu\n", i,
+                  (unsigned long long)(results[i].stop_ticks - results[i].start_ticks));
+        if (results[i].start_ticks < first_start)
+            first_start = results[i].start_ticks;
+        if (results[i].start_ticks > last_start)
+            last_start = results[i].start_ticks;
+    }
+    if (num_contexts > 1)
+        ee_printf("Launch skew      : %llu ticks\n", (unsigned long long)(last_start - first_start));
+}
+
+#if (TARGET_DURATION_SECS > 0)
+static ee_u32 calibrated_iterations[MULTITHREAD + 1];
+
+/* Function: calibrate_iterations
+	Find the iteration count that makes a parallel run of <num_contexts>
+	take about TARGET_DURATION_SECS. The count is doubled until a probe takes
+	at least a second, then scaled linearly to the target. The result is
+	kept for later runs with the same number of contexts.
+*/
+static ee_u32 calibrate_iterations(core_results *results, ee_u32 num_contexts)
+{
+    CORE_TICKS search_time = 0, probe_time;
+    secs_ret secs_passed = 0;
+    ee_u32 iterations = 1, probes = 0;
+
+    if (calibrated_iterations[num_contexts] != 0)
+        return calibrated_iterations[num_contexts];
+    while (1)
+    {
+        probe_time = run_contexts(results, num_contexts, iterations);
+        search_time += probe_time;
+        probes++;
+        secs_passed = time_in_secs(probe_time);
+        if (secs_passed >= (secs_ret)1)
+            break;
+        iterations *= 2;
+    }
+    iterations = (ee_u32)(iterations * (secs_ret)TARGET_DURATION_SECS / secs_passed);
+    if (iterations == 0)
+        iterations = 1;
+#if HAS_FLOAT
+    ee_printf("Calibrated       : %lu iterations for %d secs on %lu contexts (search %f secs, %lu probes)\n",
+              (unsigned long)iterations, TARGET_DURATION_SECS, (unsigned long)num_contexts,
+              time_in_secs(search_time), (unsigned long)probes);
+#else
+    ee_printf("Calibrated       : %lu iterations for %d secs on %lu contexts (search %lu secs, %lu probes)\n",
+              (unsigned long)iterations, TARGET_DURATION_SECS, (unsigned long)num_contexts,
+              (unsigned long)time_in_secs(search_time), (unsigned long)probes);
+#endif
+    calibrated_iterations[num_contexts] = iterations;
+    return iterations;
+}
+#endif
+
+/* Function: validate_contexts
+	Check the list, matrix and state CRCs of each context against the known
+	values for the seeds, indexed by IDX_LIST, IDX_MATRIX and IDX_STATE.
+
+	Returns:
+	Number of mismatches found.
+*/
+static ee_s16 validate_contexts(core_results *results, ee_u32 num_contexts, const ee_u16 *known)
+{
+    ee_s16 total_errors = 0;
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        results[i].err = 0;
+        if ((results[i].execs & ID_LIST) &&
+            (results[i].crclist != known[IDX_LIST]))
+        {
+            ee_printf("[%u]ERROR! list crc 0x%04x - should be 0x%04x\n", i, results[i].crclist, known[IDX_LIST]);
+#if CORE_TELEMETRY
+            core_telemetry_error(i, IDX_LIST, TELEMETRY_NO_ITERATION, results[i].crclist, known[IDX_LIST]);
+#endif
+            results[i].err++;
+        }
+        if ((results[i].execs & ID_MATRIX) &&
+            (results[i].crcmatrix != known[IDX_MATRIX]))
+        {
+            ee_printf("[%u]ERROR! matrix crc 0x%04x - should be 0x%04x\n", i, results[i].crcmatrix, known[IDX_MATRIX]);
+#if CORE_TELEMETRY
+            core_telemetry_error(i, IDX_MATRIX, TELEMETRY_NO_ITERATION, results[i].crcmatrix, known[IDX_MATRIX]);
+#endif
+            results[i].err++;
+        }
+        if ((results[i].execs & ID_STATE) &&
+            (results[i].crcstate != known[IDX_STATE]))
+        {
+            ee_printf("[%u]ERROR! state crc 0x%04x - should be 0x%04x\n", i, results[i].crcstate, known[IDX_STATE]);
+#if CORE_TELEMETRY
+            core_telemetry_error(i, IDX_STATE, TELEMETRY_NO_ITERATION, results[i].crcstate, known[IDX_STATE]);
+#endif
+            results[i].err++;
+        }
+        total_errors += results[i].err;
+    }
+    return total_errors;
+}
+
+/* Function: run_scaling_sweep
+	Run 1 to <num_contexts> contexts in turn and report each aggregate rate
+	next to the scaling efficiency against a single context.
+
+	Returns:
+	Number of CRC mismatches found, when the seeds have known CRCs.
+*/
+static ee_s16 run_scaling_sweep(core_results *results, ee_u32 num_contexts, ee_u32 iterations, const ee_u16 *known)
+{
+    secs_ret rate, single_rate = 0;
+    ee_s16 errors = 0;
+    ee_u32 c, n;
+
+    ee_printf("Contexts : Iterations/Sec : Scaling\n");
+    for (c = 1; c <= num_contexts; c++)
+    {
+        n = iterations;
+        if (n == 0)
+        {
+#if (TARGET_DURATION_SECS > 0)
+            n = calibrate_iterations(results, c);
+#else
+            n = FIXED_ITERATIONS;
+#endif
+        }
+        run_contexts(results, c, n);
+        if (known)
+            errors += validate_contexts(results, c, known);
+        rate = aggregate_rate(results, c);
+        if (c == 1)
+            single_rate = rate;
+#if HAS_FLOAT
+        ee_printf("%-8lu : %-14f : %.1f%%\n", (unsigned long)c, rate,
+                  single_rate > 0 ? 100 * rate / (c * single_rate) : 0);
+#else
+        ee_printf("%-8lu : %-14lu : %lu%%\n", (unsigned long)c, (unsigned long)rate,
+                  single_rate > 0 ? (unsigned long)(100 * rate / (c * single_rate)) : 0);
+#endif
+    }
+    return errors;
+}
+
 #if (SEED_METHOD == SEED_ARG)
 ee_s32 get_seed_args(int i, int argc, char *argv[]);
 #define get_seed(x) (ee_s16) get_seed_args(x, argc, argv)
@@ -68,9 +565,344 @@ ee_s32 get_seed_32(int i);
 #endif
 
 #if (MEM_METHOD == MEM_STATIC)
-ee_u8 static_memblk[TOTAL_DATA_SIZE];
+/* One arena per context. The port can place the first two explicitly, e.g.
+ * in different SRAM banks, through STATIC_ARENA0_ATTR and STATIC_ARENA1_ATTR */
+#ifndef STATIC_ARENA0_ATTR
+#define STATIC_ARENA0_ATTR
+#endif
+#ifndef STATIC_ARENA1_ATTR
+#define STATIC_ARENA1_ATTR
+#endif
+#define STATIC_ARENA_ALIGN 8
+static ee_u8 static_memblk0[TOTAL_DATA_SIZE] STATIC_ARENA0_ATTR __attribute__((aligned(STATIC_ARENA_ALIGN)));
+#if (MULTITHREAD > 1)
+static ee_u8 static_memblk1[TOTAL_DATA_SIZE] STATIC_ARENA1_ATTR __attribute__((aligned(STATIC_ARENA_ALIGN)));
+#endif
+#if (MULTITHREAD > 2)
+static ee_u8 static_memblk_rest[MULTITHREAD - 2][TOTAL_DATA_SIZE] __attribute__((aligned(STATIC_ARENA_ALIGN)));
+#endif
+
+static ee_u8 *static_memblk(ee_u32 ctx)
+{
+#if (MULTITHREAD > 1)
+    if (ctx == 1)
+        return static_memblk1;
+#endif
+#if (MULTITHREAD > 2)
+    if (ctx > 1)
+        return static_memblk_rest[ctx - 2];
+#endif
+    return static_memblk0;
+}
+
+/* Function: check_static_arenas
+	Check that every context's arena is aligned and that no two overlap.
+
+	Returns:
+	Number of problems found.
+*/
+static ee_s16 check_static_arenas(core_results *results, ee_u32 num_contexts)
+{
+    ee_s16 errors = 0;
+    ee_ptr_int a, b;
+    ee_u32 i, j;
+
+    for (i = 0; i < num_contexts; i++)
+    {
+        a = (ee_ptr_int)results[i].memblock[0];
+        if (a % STATIC_ARENA_ALIGN)
+        {
+            ee_printf("[%u]ERROR! static arena at %p is not %d byte aligned\n", i, results[i].memblock[0], STATIC_ARENA_ALIGN);
+            errors++;
+        }
+        for (j = i + 1; j < num_contexts; j++)
+        {
+            b = (ee_ptr_int)results[j].memblock[0];
+            if (a < b + TOTAL_DATA_SIZE && b < a + TOTAL_DATA_SIZE)
+            {
+                ee_printf("[%u]ERROR! static arena overlaps context %u\n", i, j);
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
 #endif
 char *mem_name[3] = {"Static", "Heap", "Stack"};
+
+/* Function: init_algorithms
+	Split each context's memory block between the algorithms and initialize
+	the data of each.
+*/
+static void init_algorithms(core_results *results, ee_u32 num_contexts)
+{
+    ee_u32 i, j = 0, num_algorithms = 0;
+
+    /* Data init */
+    /* Find out how space much we have based on number of algorithms */
+    for (i = 0; i < NUM_ALGORITHMS; i++)
+    {
+        if ((1 << (ee_u32)i) & results[0].execs)
+            num_algorithms++;
+    }
+    for (i = 0; i < num_contexts; i++)
+        results[i].size = results[i].size / num_algorithms;
+    /* Assign pointers */
+    for (i = 0; i < NUM_ALGORITHMS; i++)
+    {
+        ee_u32 ctx;
+        if ((1 << (ee_u32)i) & results[0].execs)
+        {
+            for (ctx = 0; ctx < num_contexts; ctx++)
+                results[ctx].memblock[i + 1] = (char *)(results[ctx].memblock[0]) + results[0].size * j;
+            j++;
+        }
+    }
+    /* call inits */
+    for (i = 0; i < num_contexts; i++)
+    {
+        if (results[i].execs & ID_LIST)
+        {
+            results[i].list = core_list_init(results[0].size, results[i].memblock[1], results[i].seed1);
+        }
+        if (results[i].execs & ID_MATRIX)
+        {
+            core_init_matrix(results[0].size, results[i].memblock[2], (ee_s32)results[i].seed1 | (((ee_s32)results[i].seed2) << 16), &(results[i].mat));
+        }
+        if (results[i].execs & ID_STATE)
+        {
+            core_init_state(results[0].size, results[i].seed1, results[i].memblock[3]);
+        }
+    }
+}
+
+/* Function: init_contexts
+	Give each context its memory block, split the block between the
+	algorithms and initialize the data of each.
+
+	Returns:
+	Number of problems found with the memory blocks.
+*/
+static ee_s16 init_contexts(core_results *results, ee_u32 num_contexts, ee_u32 arena_size, ee_u8 *stack_memblock)
+{
+    ee_s16 errors = 0;
+    ee_u32 i;
+
+#if (MEM_METHOD == MEM_STATIC)
+    for (i = 0; i < num_contexts; i++)
+    {
+        results[i].memblock[0] = (void *)static_memblk(i);
+        results[i].size = TOTAL_DATA_SIZE;
+        results[i].seed1 = results[0].seed1;
+        results[i].seed2 = results[0].seed2;
+        results[i].seed3 = results[0].seed3;
+        results[i].err = 0;
+        results[i].execs = results[0].execs;
+    }
+    errors += check_static_arenas(results, num_contexts);
+    (void)arena_size;
+    (void)stack_memblock;
+#elif (MEM_METHOD == MEM_MALLOC)
+    for (i = 0; i < num_contexts; i++)
+    {
+        results[i].size = arena_size;
+        results[i].memblock[0] = portable_malloc(results[i].size);
+        results[i].seed1 = results[0].seed1;
+        results[i].seed2 = results[0].seed2;
+        results[i].seed3 = results[0].seed3;
+        results[i].err = 0;
+        results[i].execs = results[0].execs;
+    }
+    (void)stack_memblock;
+#elif (MEM_METHOD == MEM_STACK)
+    for (i = 0; i < num_contexts; i++)
+    {
+        results[i].memblock[0] = stack_memblock + i * TOTAL_DATA_SIZE;
+        results[i].size = TOTAL_DATA_SIZE;
+        results[i].seed1 = results[0].seed1;
+        results[i].seed2 = results[0].seed2;
+        results[i].seed3 = results[0].seed3;
+        results[i].err = 0;
+        results[i].execs = results[0].execs;
+    }
+    (void)arena_size;
+#else
+#error "Please define a way to initialize a memory block."
+#endif
+    for (i = 0; i < num_contexts; i++)
+        ee_printf("[%u]memblock       : %p-%p\n", i, results[i].memblock[0],
+                  (void *)((ee_u8 *)results[i].memblock[0] + results[i].size));
+    init_algorithms(results, num_contexts);
+    return errors;
+}
+
+#if PERSISTENT_ARENA
+/* Function: snapshot_contexts
+	Copy every context's initialized memory block, so later passes can be
+	restored without running the inits again.
+*/
+static ee_u8 *snapshot_contexts(core_results *results, ee_u32 num_contexts, ee_u32 arena_size)
+{
+    ee_u8 *snapshot = (ee_u8 *)portable_malloc(num_contexts * arena_size);
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+        memcpy(snapshot + i * arena_size, results[i].memblock[0], arena_size);
+    return snapshot;
+}
+
+/* Function: restore_contexts
+	Copy the snapshot back over every context's memory block. The list
+	benchmark caches results in its data and relinks its nodes, so each pass
+	must start again from the initialized blocks to get the same CRCs.
+*/
+static void restore_contexts(core_results *results, ee_u32 num_contexts, ee_u32 arena_size, ee_u8 *snapshot)
+{
+    ee_u32 i;
+
+    for (i = 0; i < num_contexts; i++)
+        memcpy(results[i].memblock[0], snapshot + i * arena_size, arena_size);
+}
+#endif
+
+/* Function: find_size_crc
+	Look up the reference CRCs for the seeds of <res> at <size> in the
+	generated <core_golden> table, and store them in <known> by algorithm
+	index.
+
+	Returns:
+	Non zero when there is a reference.
+*/
+static int find_size_crc(core_results *res, ee_u32 size, ee_u16 *known)
+{
+    const core_golden *g;
+
+    g = core_golden_find(res->seed1, res->seed2, res->seed3, res->execs, size);
+    if (g == NULL)
+        return 0;
+    known[IDX_LIST] = g->crclist;
+    known[IDX_MATRIX] = g->crcmatrix;
+    known[IDX_STATE] = g->crcstate;
+    return 1;
+}
+
+/* Function: run_size_sweep
+	Rerun the kernels with memory blocks of TOTAL_DATA_SIZE, doubling up to
+	<max_size> bytes per context, and report the rate and the bytes per
+	second each kernel works through at each size. Work per iteration grows
+	faster than the block, so each step's iteration count is scaled from the
+	time the previous step took, to keep steps about as long as the first
+	one. The first iteration CRCs are checked where <find_size_crc> has a
+	reference for the seeds and size.
+
+	The blocks are allocated for the sweep only; the contexts are restored
+	afterwards, so the main run is not affected. When a size does not fit
+	in memory the sweep stops at the last size that did.
+
+	Returns:
+	Number of CRC mismatches found.
+*/
+static ee_s16 run_size_sweep(core_results *results, ee_u32 num_contexts, ee_u32 iterations, ee_u32 max_size)
+{
+    core_results *saved = (core_results *)portable_malloc(num_contexts * sizeof(core_results));
+    ee_u16 known[NUM_ALGORITHMS];
+    ee_s16 errors = 0;
+    ee_u32 size, n = iterations, i, k;
+    secs_ret rate, step_secs, first_secs = 0;
+#if CORE_KERNEL_TIMING
+    secs_ret kernel_rate[NUM_ALGORITHMS], secs;
+#endif
+
+    if (saved == NULL)
+    {
+        ee_printf("ERROR! No memory for the size sweep\n");
+        return 0;
+    }
+    memcpy(saved, results, num_contexts * sizeof(core_results));
+#if CORE_ITERATION_CHECK
+    /* the trace is for the main block size */
+    for (i = 0; i < num_contexts; i++)
+        results[i].check = NULL;
+#endif
+#if CORE_KERNEL_TIMING
+    ee_printf("Block bytes : Iterations/Sec : list B/s : matrix B/s : state B/s : CRC\n");
+#else
+    ee_printf("Block bytes : Iterations/Sec : CRC\n");
+#endif
+    for (size = TOTAL_DATA_SIZE; size <= max_size; size *= 2)
+    {
+        for (i = 0; i < num_contexts; i++)
+        {
+            results[i].memblock[0] = portable_malloc(size);
+            results[i].size = size;
+            if (results[i].memblock[0] == NULL)
+                break;
+        }
+        if (i < num_contexts)
+        {
+            while (i-- > 0)
+                portable_free(results[i].memblock[0]);
+            ee_printf("%-11lu : no memory, sweep ends\n", (unsigned long)size);
+            break;
+        }
+        init_algorithms(results, num_contexts);
+        step_secs = time_in_secs(run_contexts(results, num_contexts, n));
+        rate = aggregate_rate(results, num_contexts);
+#if CORE_KERNEL_TIMING
+        for (k = 0; k < NUM_ALGORITHMS; k++)
+        {
+            kernel_rate[k] = 0;
+            for (i = 0; i < num_contexts; i++)
+            {
+                secs = time_in_secs(results[i].kernel_ticks[k]);
+                if (secs > 0)
+                    kernel_rate[k] += (secs_ret)results[i].size * n / secs;
+            }
+        }
+#if HAS_FLOAT
+        ee_printf("%-11lu : %-14f : %-8.0f : %-10.0f : %-9.0f : ", (unsigned long)size, rate,
+                  kernel_rate[IDX_LIST], kernel_rate[IDX_MATRIX], kernel_rate[IDX_STATE]);
+#else
+        ee_printf("%-11lu : %-14lu : %-8lu : %-10lu : %-9lu : ", (unsigned long)size, (unsigned long)rate,
+                  (unsigned long)kernel_rate[IDX_LIST], (unsigned long)kernel_rate[IDX_MATRIX],
+                  (unsigned long)kernel_rate[IDX_STATE]);
+#endif
+#else
+#if HAS_FLOAT
+        ee_printf("%-11lu : %-14f : ", (unsigned long)size, rate);
+#else
+        ee_printf("%-11lu : %-14lu : ", (unsigned long)size, (unsigned long)rate);
+#endif
+#endif
+        if (!find_size_crc(&results[0], size, known))
+        {
+            ee_printf("%04x/%04x/%04x (no reference)\n", results[0].crclist, results[0].crcmatrix, results[0].crcstate);
+        }
+        else
+        {
+            k = 0;
+            for (i = 0; i < num_contexts; i++)
+                if (results[i].crclist != known[IDX_LIST] || results[i].crcmatrix != known[IDX_MATRIX] ||
+                    results[i].crcstate != known[IDX_STATE])
+                    k++;
+            ee_printf("%s\n", k ? "ERROR!" : "ok");
+            errors += k;
+        }
+        for (i = 0; i < num_contexts; i++)
+            portable_free(results[i].memblock[0]);
+        /* next step is at least twice the work per iteration */
+        if (size == TOTAL_DATA_SIZE)
+            first_secs = step_secs;
+        if (step_secs > 0)
+            n = (ee_u32)(n * first_secs / step_secs / 2);
+        if (n == 0)
+            n = 1;
+    }
+    memcpy(results, saved, num_contexts * sizeof(core_results));
+    portable_free(saved);
+    return errors;
+}
+
 /* Function: main
 	Main entry routine for the benchmark.
 	This function is responsible for the following steps:
@@ -97,21 +929,70 @@ MAIN_RETURN_TYPE main(void)
 MAIN_RETURN_TYPE main(int argc, char *argv[])
 {
 #endif
-    ee_u16 i, j = 0, num_algorithms = 0;
+    ee_u16 i;
     ee_s16 known_id = -1, total_errors = 0;
+    ee_u16 known_crc[NUM_ALGORITHMS];
+    const ee_u16 *known;
+    const core_golden *golden;
     ee_u16 seedcrc = 0;
-    CORE_TICKS total_time;
-    core_results results[MULTITHREAD];
+    CORE_TICKS total_time, setup_ticks, last_stop = 0, dead_ticks = 0;
+    ee_u32 arena_size;
+    const char *setup_kind;
+    core_portable port;
+    core_results *results;
 #if (MEM_METHOD == MEM_STACK)
     ee_u8 stack_memblock[TOTAL_DATA_SIZE * MULTITHREAD];
+#else
+    ee_u8 *stack_memblock = NULL;
+#endif
+#if PERSISTENT_ARENA
+    ee_u8 *arena_snapshot = NULL;
+#endif
+#if CORE_THERMAL
+    ee_u32 thermal_overhead_done = 0;
+#endif
+#if CORE_RECORD
+    core_record record = { 0 };
+#endif
+#if CORE_BASELINE
+    core_baseline_eval baseline;
+    ee_u32             requested_khz, measured_khz;
+    ee_s32             vsel;
 #endif
     /* first call any initializations needed */
-    portable_init(&(results[0].port), &argc, argv);
+    portable_init(&port, &argc, argv);
+
+    /* the port picks the number of contexts at run time */
+    if (default_num_contexts < 1)
+        default_num_contexts = 1;
+    if (default_num_contexts > MULTITHREAD)
+        default_num_contexts = MULTITHREAD;
+    results = (core_results *)portable_malloc(default_num_contexts * sizeof(core_results));
+#if CORE_LOCKSTEP
+    core_lockstep *lockstep = (core_lockstep *)portable_malloc(default_num_contexts * sizeof(core_lockstep));
+#endif
+    for (i = 0; i < default_num_contexts; i++)
+    {
+        results[i].port = port;
+#if (WORK_STEALING_CHUNK > 0)
+        results[i].sched = NULL;
+#endif
+#if CORE_LOCKSTEP
+        results[i].lockstep = &lockstep[i];
+#endif
+#if CORE_DIAGNOSE
+        results[i].diag_block = NULL;
+#endif
+#if CORE_CRASH_RECORD
+        results[i].crash_iteration = i < CRASH_CONTEXTS ? &core_crash_live.iteration[i] : NULL;
+#endif
+    }
 
     // HACK TO USE FOR STRESS TESTING
-    while (true) {
-    j = 0, num_algorithms = 0;
+    do {
     known_id = -1, total_errors = 0;
+    known = NULL;
+    golden = NULL;
     seedcrc = 0;
     
     /* First some checks to make sure benchmark will run ok */
@@ -145,124 +1026,39 @@ MAIN_RETURN_TYPE main(int argc, char *argv[])
         results[0].seed2 = 0x3415;
         results[0].seed3 = 0x66;
     }
-#if (MEM_METHOD == MEM_STATIC)
-    results[0].memblock[0] = (void *)static_memblk;
-    results[0].size = TOTAL_DATA_SIZE;
-    results[0].err = 0;
-#if (MULTITHREAD > 1)
-#error "Cannot use a static data area with multiple contexts!"
-#endif
-#elif (MEM_METHOD == MEM_MALLOC)
-    for (i = 0; i < MULTITHREAD; i++)
-    {
-        ee_s32 malloc_override = get_seed(7);
-        if (malloc_override != 0)
-            results[i].size = malloc_override;
-        else
-            results[i].size = TOTAL_DATA_SIZE;
-        results[i].memblock[0] = portable_malloc(results[i].size);
-        results[i].seed1 = results[0].seed1;
-        results[i].seed2 = results[0].seed2;
-        results[i].seed3 = results[0].seed3;
-        results[i].err = 0;
-        results[i].execs = results[0].execs;
-    }
-#elif (MEM_METHOD == MEM_STACK)
-for (i = 0; i < MULTITHREAD; i++)
-{
-    results[i].memblock[0] = stack_memblock + i * TOTAL_DATA_SIZE;
-    results[i].size = TOTAL_DATA_SIZE;
-    results[i].seed1 = results[0].seed1;
-    results[i].seed2 = results[0].seed2;
-    results[i].seed3 = results[0].seed3;
-    results[i].err = 0;
-    results[i].execs = results[0].execs;
-}
+    /* memory block size, before it is split between the algorithms */
+#if (MEM_METHOD == MEM_MALLOC)
+    arena_size = get_seed_32(7);
+    if (arena_size == 0)
+        arena_size = TOTAL_DATA_SIZE;
 #else
-#error "Please define a way to initialize a memory block."
+    arena_size = TOTAL_DATA_SIZE;
 #endif
-    /* Data init */
-    /* Find out how space much we have based on number of algorithms */
-    for (i = 0; i < NUM_ALGORITHMS; i++)
+    setup_ticks = barebones_clock();
+#if PERSISTENT_ARENA
+    if (arena_snapshot == NULL)
     {
-        if ((1 << (ee_u32)i) & results[0].execs)
-            num_algorithms++;
+        total_errors += init_contexts(results, default_num_contexts, arena_size, stack_memblock);
+        arena_snapshot = snapshot_contexts(results, default_num_contexts, arena_size);
+        setup_kind = "init";
     }
-    for (i = 0; i < MULTITHREAD; i++)
-        results[i].size = results[i].size / num_algorithms;
-    /* Assign pointers */
-    for (i = 0; i < NUM_ALGORITHMS; i++)
+    else
     {
-        ee_u32 ctx;
-        if ((1 << (ee_u32)i) & results[0].execs)
-        {
-            for (ctx = 0; ctx < MULTITHREAD; ctx++)
-                results[ctx].memblock[i + 1] = (char *)(results[ctx].memblock[0]) + results[0].size * j;
-            j++;
-        }
-    }
-    /* call inits */
-    for (i = 0; i < MULTITHREAD; i++)
-    {
-        if (results[i].execs & ID_LIST)
-        {
-            results[i].list = core_list_init(results[0].size, results[i].memblock[1], results[i].seed1);
-        }
-        if (results[i].execs & ID_MATRIX)
-        {
-            core_init_matrix(results[0].size, results[i].memblock[2], (ee_s32)results[i].seed1 | (((ee_s32)results[i].seed2) << 16), &(results[i].mat));
-        }
-        if (results[i].execs & ID_STATE)
-        {
-            core_init_state(results[0].size, results[i].seed1, results[i].memblock[3]);
-        }
-    }
-
-#if 0
-    /* automatically determine number of iterations if not set */
-    if (results[0].iterations == 0)
-    {
-        secs_ret secs_passed = 0;
-        ee_u32 divisor;
-        results[0].iterations = 1;
-        while (secs_passed < (secs_ret)1)
-        {
-            results[0].iterations *= 10;
-            start_time();
-            iterate(&results[0]);
-            stop_time();
-            secs_passed = time_in_secs(get_time());
-        }
-        /* now we know it executes for at least 1 sec, set actual run time at about 10 secs */
-        divisor = (ee_u32)secs_passed;
-        if (divisor == 0) /* some machines cast float to int as 0 since this conversion is not defined by ANSI, but we know at least one second passed */
-            divisor = 1;
-        results[0].iterations *= 1 + 10 / divisor;
+        restore_contexts(results, default_num_contexts, arena_size, arena_snapshot);
+        setup_kind = "restore";
     }
+#else
+    total_errors += init_contexts(results, default_num_contexts, arena_size, stack_memblock);
+    setup_kind = "init";
 #endif
-    results[0].iterations = 4000;
-    /* perform actual benchmark */
-    start_time();
-#if (MULTITHREAD > 1)
-    if (default_num_contexts < MULTITHREAD)
-    {
-        default_num_contexts = MULTITHREAD;
-    }
-    for (i = 0; i < default_num_contexts; i++)
-    {
-        results[i].iterations = results[0].iterations;
-        results[i].execs = results[0].execs;
-        core_start_parallel(i, &results[i]);
-    }
+    setup_ticks = barebones_clock() - setup_ticks;
+#if CORE_ITERATION_HISTOGRAM
     for (i = 0; i < default_num_contexts; i++)
-    {
-        core_end_parallel(i);
-    }
-#else
-    iterate(&results[0]);
+        results[i].hist = &iteration_hist[i];
 #endif
-    stop_time();
-    total_time = get_time();
+
+    for (i = 0; i < default_num_contexts; i++)
+        results[i].execs = results[0].execs;
     /* get a function of the input to report */
     seedcrc = crc16(results[0].seed1, seedcrc);
     seedcrc = crc16(results[0].seed2, seedcrc);
@@ -296,44 +1092,179 @@ for (i = 0; i < MULTITHREAD; i++)
         break;
     }
     if (known_id >= 0)
+    {
+        known_crc[IDX_LIST] = list_known_crc[known_id];
+        known_crc[IDX_MATRIX] = matrix_known_crc[known_id];
+        known_crc[IDX_STATE] = state_known_crc[known_id];
+        known = known_crc;
+    }
+    golden = core_golden_find(results[0].seed1, results[0].seed2, results[0].seed3, results[0].execs, arena_size);
+    if (known == NULL && golden)
+    {
+        ee_printf("Generated reference run parameters for coremark.\n");
+        known_crc[IDX_LIST] = golden->crclist;
+        known_crc[IDX_MATRIX] = golden->crcmatrix;
+        known_crc[IDX_STATE] = golden->crcstate;
+        known = known_crc;
+        total_errors = 0;
+    }
+#if CORE_ITERATION_CHECK
+    for (i = 0; i < default_num_contexts; i++)
+    {
+        results[i].check = golden ? golden->trace : NULL;
+        results[i].check_iterations = results[i].check ? golden->iterations : 0;
+#if CORE_DIAGNOSE
+        if (results[i].check && results[i].diag_block == NULL)
+        {
+            results[i].diag_size = arena_size;
+            results[i].diag_block = (ee_u8 *)portable_malloc(arena_size);
+        }
+#endif
+    }
+#endif
+#if (STREAM_WINDOW_ITERATIONS > 0)
+    core_stream(results, default_num_contexts, known);
+#endif
+    if (scaling_sweep && default_num_contexts > 1)
+    {
+        ee_s16 sweep_errors = run_scaling_sweep(results, default_num_contexts, results[0].iterations, known);
+        if (known)
+            total_errors += sweep_errors;
+    }
+    if (data_size_sweep)
+    {
+        ee_u32 n = results[0].iterations;
+        if (n == 0)
+        {
+#if (TARGET_DURATION_SECS > 0)
+            n = calibrate_iterations(results, default_num_contexts);
+#else
+            n = FIXED_ITERATIONS;
+#endif
+        }
+        total_errors += run_size_sweep(results, default_num_contexts, n, data_size_sweep);
+    }
+    /* automatically determine number of iterations if not set */
+    if (results[0].iterations == 0)
+    {
+#if (TARGET_DURATION_SECS > 0)
+        results[0].iterations = calibrate_iterations(results, default_num_contexts);
+#else
+        results[0].iterations = FIXED_ITERATIONS;
+#endif
+    }
+    /* perform actual benchmark */
+    if (last_stop)
+        dead_ticks = barebones_clock() - last_stop;
+#if CORE_RECORD
+    record.temp_start = read_onboard_temperature();
+#endif
+#if CORE_THERMAL
+    core_thermal_start(results, default_num_contexts);
+#endif
+#if CORE_CLOCK_MEASURE
+    core_clock_start();
+#endif
+#if (WORK_STEALING_CHUNK > 0)
+    total_time = core_sched_run(results, default_num_contexts, results[0].iterations);
+#else
+    total_time = run_contexts(results, default_num_contexts, results[0].iterations);
+#endif
+    last_stop = barebones_clock();
+#if CORE_CLOCK_MEASURE
+    core_clock_stop();
+#endif
+#if CORE_RECORD
+    record.temp_end = read_onboard_temperature();
+#endif
+#if CORE_THERMAL
+    core_thermal_stop();
+    /* an aborted run stopped short, so its CRCs say nothing */
+    if (core_thermal_report())
+    {
+        total_errors = (total_errors < 0 ? 0 : total_errors) + 1;
+        known = NULL;
+        golden = NULL;
+    }
+#endif
+#if CORE_LOCKSTEP
+    {
+        /* a mismatch between contexts is an error even for seeds that
+         * cannot otherwise be validated */
+        ee_s16 lockstep_errors = core_lockstep_report(results, default_num_contexts);
+        if (lockstep_errors)
+            total_errors = (total_errors < 0 ? 0 : total_errors) + lockstep_errors;
+    }
+#endif
+#if CORE_ITERATION_CHECK
+    /* the CRCs of an aborted run are incomplete, the divergence is the
+     * result */
+    if (core_check_abort)
+    {
+        total_errors += report_divergence(results, default_num_contexts);
+#if CORE_DIAGNOSE
+        for (i = 0; i < default_num_contexts; i++)
+            if (results[i].fail_kernel && results[i].diag_block)
+                core_diagnose(&results[i], i, golden);
+#endif
+        known = NULL;
+        golden = NULL;
+    }
+#endif
+    if (known)
+        total_errors += validate_contexts(results, default_num_contexts, known);
+#if (WORK_STEALING_CHUNK == 0)
+    /* the final CRC depends on the iteration count, so only a generated
+     * reference for the same count has it */
+    if (golden && golden->iterations == results[0].iterations)
     {
         for (i = 0; i < default_num_contexts; i++)
         {
-            results[i].err = 0;
-            if ((results[i].execs & ID_LIST) &&
-                (results[i].crclist != list_known_crc[known_id]))
+            if (results[i].crc != golden->crc)
             {
-                ee_printf("[%u]ERROR! list crc 0x%04x - should be 0x%04x\n", i, results[i].crclist, list_known_crc[known_id]);
-                results[i].err++;
-            }
-            if ((results[i].execs & ID_MATRIX) &&
-                (results[i].crcmatrix != matrix_known_crc[known_id]))
-            {
-                ee_printf("[%u]ERROR! matrix crc 0x%04x - should be 0x%04x\n", i, results[i].crcmatrix, matrix_known_crc[known_id]);
-                results[i].err++;
-            }
-            if ((results[i].execs & ID_STATE) &&
-                (results[i].crcstate != state_known_crc[known_id]))
-            {
-                ee_printf("[%u]ERROR! state crc 0x%04x - should be 0x%04x\n", i, results[i].crcstate, state_known_crc[known_id]);
+                ee_printf("[%u]ERROR! final crc 0x%04x - should be 0x%04x\n", i, results[i].crc, golden->crc);
+#if CORE_TELEMETRY
+                core_telemetry_error(i, TELEMETRY_KERNEL_FINAL, TELEMETRY_NO_ITERATION, results[i].crc, golden->crc);
+#endif
                 results[i].err++;
+                total_errors++;
             }
-            total_errors += results[i].err;
         }
     }
+#endif
     total_errors += check_data_types();
+    report_context_timing(results, default_num_contexts);
+#if CORE_CLOCK_MEASURE && HAS_FLOAT
+    core_clock_print(&core_clock_run);
+#if !CORE_BASELINE
+    if (core_clock_khz(&core_clock_run))
+        ee_printf("CoreMark/MHz     : %f\n",
+                  aggregate_rate(results, default_num_contexts) * 1000 / core_clock_khz(&core_clock_run));
+#endif
+#endif
+#if CORE_BASELINE
+    portable_clock_info(&requested_khz, &measured_khz, &vsel);
+    core_baseline_eval_run(&baseline, aggregate_rate(results, default_num_contexts),
+                           default_num_contexts, measured_khz);
+    core_baseline_report(&baseline);
+    if (baseline_calibrate && total_errors == 0)
+        core_baseline_calibrate(baseline.score, default_num_contexts, measured_khz);
+#endif
+    ee_printf("Setup ticks      : %llu (%s)\n", (unsigned long long)setup_ticks, setup_kind);
+    if (dead_ticks)
+        ee_printf("Dead time        : %llu ticks since previous run\n", (unsigned long long)dead_ticks);
     /* and report results */
 #if 0
     ee_printf("CoreMark Size    : %lu\n", (long unsigned)results[0].size);
-    ee_printf("Total ticks      : %lu\n", (long unsigned)total_time);
+    ee_printf("Total ticks      : %llu\n", (unsigned long long)total_time);
 #if HAS_FLOAT
     ee_printf("Total time (secs): %f\n", time_in_secs(total_time));
     if (time_in_secs(total_time) > 0)
-        ee_printf("Iterations/Sec   : %f\n", default_num_contexts * results[0].iterations / time_in_secs(total_time));
+        ee_printf("Iterations/Sec   : %f\n", aggregate_rate(results, default_num_contexts));
 #else
     ee_printf("Total time (secs): %d\n", time_in_secs(total_time));
     if (time_in_secs(total_time) > 0)
-        ee_printf("Iterations/Sec   : %d\n", default_num_contexts * results[0].iterations / time_in_secs(total_time));
+        ee_printf("Iterations/Sec   : %d\n", aggregate_rate(results, default_num_contexts));
 #endif
     if (time_in_secs(total_time) < 10)
     {
@@ -368,7 +1299,7 @@ for (i = 0; i < MULTITHREAD; i++)
 #if HAS_FLOAT
         if (known_id == 3)
         {
-            ee_printf("CoreMark 1.0 : %f / %s %s", default_num_contexts * results[0].iterations / time_in_secs(total_time), COMPILER_VERSION, COMPILER_FLAGS);
+            ee_printf("CoreMark 1.0 : %f / %s %s", aggregate_rate(results, default_num_contexts), COMPILER_VERSION, COMPILER_FLAGS);
 #if defined(MEM_LOCATION) && !defined(MEM_LOCATION_UNSPEC)
             ee_printf(" / %s", MEM_LOCATION);
 #else
@@ -382,21 +1313,55 @@ for (i = 0; i < MULTITHREAD; i++)
         }
 #endif
     }
+#if CORE_KERNEL_TIMING
+    report_kernel_ticks(results, default_num_contexts);
+#endif
+#if CORE_ITERATION_HISTOGRAM
+    report_iteration_latency(results, default_num_contexts);
+#endif
     if (total_errors > 0)
         ee_printf("Errors detected\n");
     if (total_errors < 0)
         ee_printf("Cannot validate operation for these seed values, please compare with results on a known platform.\n");
+#if CORE_RECORD
+    record.ticks = total_time;
+    record.score = aggregate_rate(results, default_num_contexts);
+    record.errors = total_errors < 0 ? -1 : total_errors;
+#if CORE_BASELINE
+    record.baseline_mhz   = baseline.baseline_mhz;
+    record.equivalent_mhz = baseline.equivalent_mhz;
+    record.drift_pct      = baseline.drift_pct;
+#endif
+    core_record_print(&record, results, default_num_contexts);
+    record.run++;
+#endif
+#if CORE_TELEMETRY
+    core_telemetry_result(aggregate_rate(results, default_num_contexts), default_num_contexts,
+                          results[0].iterations, total_errors);
+#endif
+#if CORE_LOG
+    if (core_log_dropped())
+        ee_printf("Console dropped  : %lu bytes\n", (unsigned long)core_log_dropped());
+#endif
+#if CORE_THERMAL && (WORK_STEALING_CHUNK == 0)
+    /* asked for, and once, as it costs 2 * THERMAL_OVERHEAD_PAIRS more runs */
+    if (thermal_overhead && !thermal_overhead_done)
+    {
+        core_thermal_overhead(results, default_num_contexts, results[0].iterations);
+        thermal_overhead_done = 1;
+    }
+#endif
 
-#if (MEM_METHOD == MEM_MALLOC)
-    for (i = 0; i < MULTITHREAD; i++)
+#if (MEM_METHOD == MEM_MALLOC) && !PERSISTENT_ARENA
+    for (i = 0; i < default_num_contexts; i++)
         portable_free(results[i].memblock[0]);
 #endif
 
     /* And last call any target specific code for finalizing */
-    portable_fini(&(results[0].port));
+    portable_fini(&port);
 
     // HACK stress testing
-    }
+    } while (STRESS_LOOP);
 
     return MAIN_RETURN_VAL;
 }
@@ -0,0 +1,161 @@
+/**
+ * @file      core_record.c
+ *
+ * @brief Machine readable record of each run
+ */
+
+#include "coremark.h"
+#include "core_record.h"
+#include <stdarg.h>
+#if CORE_THERMAL
+#include "core_thermal.h"
+#endif
+
+/* Features of the build, space separated */
+static const char record_features[] = ""
+#if CORE_KERNEL_TIMING
+    " kernel_timing"
+#endif
+#if CORE_ITERATION_HISTOGRAM
+    " histogram"
+#endif
+#if CORE_ITERATION_CHECK
+    " iteration_check"
+#endif
+#if CORE_DIAGNOSE
+    " diagnose"
+#endif
+#if CORE_CRASH_RECORD
+    " crash_record"
+#endif
+#if CORE_THERMAL
+    " thermal"
+#endif
+#if CORE_LOG
+    " log"
+#endif
+#if CORE_TELEMETRY
+    " telemetry"
+#endif
+#if CORE_CLOCK_MEASURE
+    " clock_measure"
+#endif
+#if CORE_BASELINE
+    " baseline"
+#endif
+#if CORE_LOCKSTEP
+    " lockstep"
+#endif
+#if (WORK_STEALING_CHUNK > 0)
+    " work_stealing"
+#endif
+#if PERSISTENT_ARENA
+    " persistent_arena"
+#endif
+    ;
+
+/* Function : record_put
+        Format one piece of the record, add it to the checksum <crc> and
+   print it.
+*/
+static void
+record_put(ee_u16 *crc, const char *fmt, ...)
+{
+    char        piece[RECORD_PIECE_BYTES];
+    const char *p;
+    va_list     args;
+
+    va_start(args, fmt);
+    vsnprintf(piece, sizeof(piece), fmt, args);
+    va_end(args);
+    for (p = piece; *p; p++)
+        *crc = crcu8((ee_u8)*p, *crc);
+    ee_printf("%s", piece);
+}
+
+/* Function : record_temp
+        Print the field <name> of temperature <t>, null when not known.
+*/
+static void
+record_temp(ee_u16 *crc, const char *name, float t)
+{
+    if (TEMP_KNOWN(t))
+        record_put(crc, "\"%s\":%.1f,", name, (double)t);
+    else
+        record_put(crc, "\"%s\":null,", name);
+}
+
+/* Function : core_record_print
+        Print the record of the run <r> of <results>. It is printed in
+   pieces, so any number of contexts fits the buffer of <ee_printf>, with
+   the newline only at the end. The last piece holds a CRC16 of all the
+   others, so a line that lost a piece on the way, to a full console ring
+   or a noisy UART, is not taken as a record.
+*/
+void
+core_record_print(const core_record *r, core_results *results, ee_u32 num_contexts)
+{
+    ee_u32   requested_khz = 0, measured_khz = 0, i;
+    ee_s32   vsel          = -1;
+    float    peak          = r->temp_start;
+    ee_u16   crc           = 0;
+    secs_ret mhz;
+
+    portable_clock_info(&requested_khz, &measured_khz, &vsel);
+    mhz = measured_khz / (secs_ret)1000;
+    if (!TEMP_KNOWN(peak) || r->temp_end > peak)
+        peak = r->temp_end;
+#if CORE_THERMAL
+    if (core_thermal_run.count && (!TEMP_KNOWN(peak) || core_thermal_run.peak10 / 10.0f > peak))
+        peak = core_thermal_run.peak10 / 10.0f;
+#endif
+
+    record_put(&crc,
+               "{\"record\":\"coremark\",\"run\":%lu,\"score\":%.3f,\"coremark_mhz\":%.4f,",
+               (unsigned long)r->run,
+               (double)r->score,
+               (double)(mhz > 0 ? r->score / mhz : 0));
+    if (r->baseline_mhz > 0)
+        record_put(&crc,
+                   "\"baseline_coremark_mhz\":%.4f,\"equivalent_mhz\":%.3f,\"drift_pct\":%.2f,",
+                   (double)r->baseline_mhz,
+                   (double)r->equivalent_mhz,
+                   (double)r->drift_pct);
+    else
+        record_put(&crc, "\"baseline_coremark_mhz\":null,\"equivalent_mhz\":null,\"drift_pct\":null,");
+    record_put(&crc,
+               "\"ticks\":%llu,\"iterations\":%lu,\"contexts\":%lu,\"size\":%lu,\"valid\":%s,\"errors\":%d,",
+               (unsigned long long)r->ticks,
+               (unsigned long)results[0].iterations,
+               (unsigned long)num_contexts,
+               (unsigned long)results[0].size,
+               r->errors == 0 ? "true" : "false",
+               (int)r->errors);
+    record_put(&crc,
+               "\"requested_mhz\":%.3f,\"measured_mhz\":%.3f,\"vsel\":%ld,",
+               requested_khz / 1000.0,
+               measured_khz / 1000.0,
+               (long)vsel);
+    record_temp(&crc, "temp_start_c", r->temp_start);
+    record_temp(&crc, "temp_end_c", r->temp_end);
+    record_temp(&crc, "temp_peak_c", peak);
+    record_put(&crc, "\"compiler\":\"%s\",", COMPILER_VERSION);
+    record_put(&crc, "\"flags\":\"%s\",", COMPILER_FLAGS);
+    record_put(&crc,
+               "\"mem\":\"%s\",\"features\":\"%s\",\"cores\":[",
+               MEM_LOCATION,
+               record_features[0] ? record_features + 1 : "");
+    for (i = 0; i < num_contexts; i++)
+        record_put(&crc,
+                   "%s{\"core\":%lu,\"crclist\":\"0x%04x\",\"crcmatrix\":\"0x%04x\",\"crcstate\":\"0x%04x\","
+                   "\"crcfinal\":\"0x%04x\",\"ticks\":%llu,\"errors\":%d}",
+                   i ? "," : "",
+                   (unsigned long)i,
+                   results[i].crclist,
+                   results[i].crcmatrix,
+                   results[i].crcstate,
+                   results[i].crc,
+                   (unsigned long long)(results[i].stop_ticks - results[i].start_ticks),
+                   (int)results[i].err);
+    ee_printf("],\"check\":\"0x%04x\"}\n", crcu8(']', crc));
+}
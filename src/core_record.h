@@ -0,0 +1,64 @@
+/**
+ * @file      core_record.h
+ *
+ * @brief Machine readable record of each run
+ */
+
+/* Topic : Description
+        After each pass <core_record_print> prints one JSON object on a line
+   of its own, starting {"record":"coremark", with everything a dashboard
+   needs about the run:
+
+        run - pass number, from 0.
+        score - iterations per second of all contexts together.
+        coremark_mhz - score per measured MHz, 0 when not measured.
+        baseline_coremark_mhz, equivalent_mhz, drift_pct - against the
+        baseline of the build (see <core_baseline.h>), null without one.
+        ticks, iterations, contexts, size - of the timed run.
+        valid, errors - as the text report, errors -1 for seeds that cannot
+        be validated.
+        requested_mhz, measured_mhz, vsel - from <portable_clock_info>, 0
+        (or -1 for vsel) when the port does not know.
+        temp_start_c, temp_end_c, temp_peak_c - around the timed run, the
+        peak from the background sampler when there is one, null without a
+        sensor.
+        compiler, flags, mem, features - of the build.
+        cores - per context crclist, crcmatrix, crcstate, crcfinal (as hex
+        strings), ticks and errors.
+        check - CRC16 (<crcu8>) of the line from the opening brace up to the
+        comma before it, as a hex string. The record is printed in pieces,
+        and a line that lost one fails the check.
+
+        tools/coremark_results.h parses these lines back on the host.
+*/
+#ifndef CORE_RECORD_H
+#define CORE_RECORD_H
+
+#include "core_portme.h"
+
+#ifndef RECORD_PIECE_BYTES
+#define RECORD_PIECE_BYTES 512 /* Longest piece, such as the compiler flags */
+#endif
+
+struct RESULTS_S;
+
+typedef struct CORE_RECORD_S
+{
+    ee_u32     run;
+    CORE_TICKS ticks;  /* Of the whole timed run */
+    secs_ret   score;
+    ee_s16     errors; /* -1 when the seeds cannot be validated */
+    float      temp_start;
+    float      temp_end;
+    secs_ret   baseline_mhz;   /* CoreMark/MHz of the baseline, 0 without one */
+    secs_ret   equivalent_mhz;
+    secs_ret   drift_pct;      /* From linear scaling */
+} core_record;
+
+void core_record_print(const core_record *r, struct RESULTS_S *results, ee_u32 num_contexts);
+
+/* Port side: requested and measured clk_sys in kHz, 0 when not known, and
+ * the voltage setting, -1 when not known */
+void portable_clock_info(ee_u32 *requested_khz, ee_u32 *measured_khz, ee_s32 *vsel);
+
+#endif /* CORE_RECORD_H */
@@ -0,0 +1,189 @@
+/**
+ * @file      core_sched.c
+ *
+ * @brief Work stealing iteration scheduler
+ */
+
+#include "core_sched.h"
+
+#if (WORK_STEALING_CHUNK > 0)
+
+#define RANGE(lo, hi) ((ee_u32)(lo) | ((ee_u32)(hi) << 16))
+#define RANGE_LO(r)   ((r) & 0xffff)
+#define RANGE_HI(r)   ((r) >> 16)
+#define MAX_CHUNKS    0xffff
+
+/* Function : take_chunk
+        Take the chunk at the bottom of a worker's own deque.
+
+        Returns:
+        The chunk index, or -1 when the deque is empty.
+*/
+static ee_s32
+take_chunk(core_sched_worker *w)
+{
+    unsigned int r = atomic_load(&w->range);
+
+    do
+    {
+        if (RANGE_LO(r) >= RANGE_HI(r))
+            return -1;
+    } while (!atomic_compare_exchange_weak(
+        &w->range, &r, RANGE(RANGE_LO(r) + 1, RANGE_HI(r))));
+    return RANGE_LO(r);
+}
+
+/* Function : steal_chunk
+        Take the chunk at the top of another worker's deque. The last chunk
+   is always left to its owner, so every worker runs at least one chunk and
+   reports CRCs that can be validated.
+
+        Returns:
+        The chunk index, or -1 when there is nothing to steal.
+*/
+static ee_s32
+steal_chunk(core_sched_worker *w)
+{
+    unsigned int r = atomic_load(&w->range);
+
+    do
+    {
+        if (RANGE_HI(r) - RANGE_LO(r) < 2)
+            return -1;
+    } while (!atomic_compare_exchange_weak(
+        &w->range, &r, RANGE(RANGE_LO(r), RANGE_HI(r) - 1)));
+    return RANGE_HI(r) - 1;
+}
+
+/* Function : core_sched_worker_run
+        Body of one worker, called from <iterate> in place of the fixed
+   iteration loop. Each chunk runs as a plain <iterate> on a copy of the
+   context, and its timings are folded back into the context.
+*/
+void *
+core_sched_worker_run(core_results *res)
+{
+    core_sched *       s    = res->sched;
+    ee_u32             id   = res - s->results;
+    core_sched_worker *self = &s->workers[id];
+    core_results       chunk;
+    ee_s32             c;
+    ee_u32             i, k;
+
+    self->chunks     = 0;
+    self->iterations = 0;
+    self->stolen     = 0;
+#if CORE_KERNEL_TIMING
+    for (k = 0; k < NUM_ALGORITHMS; k++)
+        res->kernel_ticks[k] = 0;
+#endif
+    res->start_ticks = barebones_clock();
+    while (1)
+    {
+        c = take_chunk(self);
+        for (i = 1; c < 0 && i < s->num_workers; i++)
+        {
+            c = steal_chunk(&s->workers[(id + i) % s->num_workers]);
+            if (c >= 0)
+                self->stolen++;
+        }
+        if (c < 0)
+            break;
+
+        chunk       = *res;
+        chunk.sched = NULL;
+#if CORE_ITERATION_CHECK
+        chunk.check = NULL;
+#endif
+#if CORE_LOCKSTEP
+        chunk.lockstep = NULL;
+#endif
+#if CORE_ITERATION_HISTOGRAM
+        chunk.hist = NULL;
+#endif
+        chunk.iterations = s->total - c * s->chunk;
+        if (chunk.iterations > s->chunk)
+            chunk.iterations = s->chunk;
+        iterate(&chunk);
+
+        s->chunk_crc[c] = chunk.crc;
+        if (self->chunks == 0)
+        {
+            res->crclist   = chunk.crclist;
+            res->crcmatrix = chunk.crcmatrix;
+            res->crcstate  = chunk.crcstate;
+        }
+#if CORE_KERNEL_TIMING
+        for (k = 0; k < NUM_ALGORITHMS; k++)
+            res->kernel_ticks[k] += chunk.kernel_ticks[k];
+#endif
+        self->chunks++;
+        self->iterations += chunk.iterations;
+    }
+    res->stop_ticks = barebones_clock();
+    return NULL;
+}
+
+/* Function : core_sched_run
+        Run <num_contexts> x <iterations> iterations as chunks of
+   WORK_STEALING_CHUNK pulled by every context, then report each worker's
+   share.
+
+        Returns:
+        Ticks from the first worker starting to the last one finishing.
+*/
+CORE_TICKS
+core_sched_run(core_results *results, ee_u32 num_contexts, ee_u32 iterations)
+{
+    core_sched s;
+    CORE_TICKS ticks;
+    ee_u32     num_chunks, i;
+    ee_u16     crc = 0;
+
+    s.results     = results;
+    s.num_workers = num_contexts;
+    s.total       = num_contexts * iterations;
+    s.chunk       = WORK_STEALING_CHUNK;
+    /* every worker needs a chunk, and indexes must fit in 16 bits */
+    if (s.chunk > iterations)
+        s.chunk = iterations;
+    if (s.total / s.chunk >= MAX_CHUNKS)
+        s.chunk = s.total / (MAX_CHUNKS - 1) + 1;
+    num_chunks = (s.total + s.chunk - 1) / s.chunk;
+
+    s.workers = (core_sched_worker *)portable_malloc(
+        num_contexts * sizeof(core_sched_worker));
+    s.chunk_crc = (ee_u16 *)portable_malloc(num_chunks * sizeof(ee_u16));
+    for (i = 0; i < num_contexts; i++)
+    {
+        atomic_init(&s.workers[i].range,
+                    RANGE(i * num_chunks / num_contexts,
+                          (i + 1) * num_chunks / num_contexts));
+        results[i].sched = &s;
+    }
+
+    ticks = run_contexts(results, num_contexts, iterations);
+
+    for (i = 0; i < num_chunks; i++)
+        crc = crcu16(s.chunk_crc[i], crc);
+    for (i = 0; i < num_contexts; i++)
+    {
+        results[i].sched      = NULL;
+        results[i].crc        = crc;
+        results[i].iterations = s.workers[i].iterations;
+        ee_printf("[%u]worker share   : %lu iterations (%lu%%), %lu chunks, %lu stolen\n",
+                  i,
+                  (unsigned long)s.workers[i].iterations,
+                  (unsigned long)((ee_u64)s.workers[i].iterations * 100 / s.total),
+                  (unsigned long)s.workers[i].chunks,
+                  (unsigned long)s.workers[i].stolen);
+    }
+    ee_printf("Chunks           : %lu of %lu iterations\n",
+              (unsigned long)num_chunks, (unsigned long)s.chunk);
+
+    portable_free(s.chunk_crc);
+    portable_free(s.workers);
+    return ticks;
+}
+
+#endif
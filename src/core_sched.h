@@ -0,0 +1,43 @@
+/**
+ * @file      core_sched.h
+ *
+ * @brief Work stealing iteration scheduler
+ */
+
+/* Topic : Description
+        In the default mode every context runs the same number of iterations,
+   so the slowest core sets the wall time. With WORK_STEALING_CHUNK set, the
+   iterations of all contexts are pooled and split into chunks. Each worker
+   owns a deque of chunks, takes from its bottom and, once empty, steals from
+   the top of the other workers' deques.
+
+        Chunks are preassigned, so a deque is a [lo, hi) range of chunk
+   indexes packed in one 32 bit word and updated by compare and swap. Every
+   chunk's CRC is kept by index and folded in index order afterwards, so the
+   final CRC does not depend on which worker ran which chunk.
+*/
+#ifndef CORE_SCHED_H
+#define CORE_SCHED_H
+
+#include "coremark.h"
+#include <stdatomic.h>
+
+typedef struct CORE_SCHED_WORKER_S
+{
+    atomic_uint range;      /* Chunks left, lo | hi << 16 */
+    ee_u32      chunks;     /* Chunks this worker ran */
+    ee_u32      iterations; /* Iterations this worker ran */
+    ee_u32      stolen;     /* Chunks taken from other workers */
+} core_sched_worker;
+
+typedef struct CORE_SCHED_S
+{
+    core_results *     results;     /* Context of worker 0 */
+    core_sched_worker *workers;     /* One deque per context */
+    ee_u32             num_workers;
+    ee_u32             chunk;       /* Iterations per chunk */
+    ee_u32             total;       /* Iterations over all chunks */
+    ee_u16 *           chunk_crc;   /* Final CRC of each chunk, by index */
+} core_sched;
+
+#endif /* CORE_SCHED_H */
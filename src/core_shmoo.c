@@ -0,0 +1,107 @@
+/**
+ * @file      core_shmoo.c
+ *
+ * @brief Voltage by clock characterisation grid
+ */
+
+#include "coremark.h"
+#include "core_shmoo.h"
+
+/* Function : core_shmoo_resumable
+        Returns:
+        Non zero when <words>, as loaded by <portable_tune_load>, hold a grid
+        that was interrupted.
+*/
+ee_u32
+core_shmoo_resumable(const ee_u32 *words)
+{
+    return (words[0] >> 24) == SHMOO_MAGIC;
+}
+
+/* Function : shmoo_point
+        Print the line of one point.
+*/
+static void
+shmoo_point(const char *chip, ee_u32 mv, ee_u32 mhz, const char *result, double score)
+{
+    float temp = read_onboard_temperature();
+
+    if (TEMP_KNOWN(temp))
+        ee_printf("shmoo,%s,%lu,%lu,%s,%.2f,%.1f\n",
+                  chip,
+                  (unsigned long)mv,
+                  (unsigned long)mhz,
+                  result,
+                  score,
+                  (double)temp);
+    else
+        ee_printf("shmoo,%s,%lu,%lu,%s,%.2f,\n",
+                  chip,
+                  (unsigned long)mv,
+                  (unsigned long)mhz,
+                  result,
+                  score);
+}
+
+/* Function : core_shmoo_run
+        Run the grid, starting after the point saved in <resume> when it is
+   not NULL, which is reported as a hang.
+*/
+void
+core_shmoo_run(const core_tune_level *levels, ee_u32 num_levels, const ee_u32 *resume)
+{
+    static const char *kernel[] = { "pass", "list", "matrix", "", "state" };
+    char         chip[32];
+    ee_u32       words[TUNE_WORDS] = { 0 };
+    ee_u32       level = 0, mhz = SHMOO_MIN_MHZ, kind;
+    CORETIMETYPE start;
+    secs_ret     secs;
+
+    portable_chip_id(chip, sizeof(chip));
+    if (num_levels > 16)
+        num_levels = 16;
+    if (resume && core_shmoo_resumable(resume))
+    {
+        level = (resume[0] >> 20) & 0xf;
+        mhz   = (resume[0] >> 10) & 0x3ff;
+        /* a stale or corrupted word can name a level this grid has not got */
+        if (level >= num_levels)
+        {
+            ee_printf("Shmoo          : saved level %lu is not in the grid, not resumed\n",
+                      (unsigned long)level);
+            portable_tune_save(words);
+            return;
+        }
+        shmoo_point(chip, levels[level].mv, mhz, "hang", 0);
+        mhz += SHMOO_STEP_MHZ;
+    }
+    else
+        ee_printf("shmoo,chip,mv,mhz,result,coremark_mhz,temp_c\n");
+
+    portable_tune_set(levels[level].vsel, TUNE_MIN_MHZ);
+    core_tune_reference(SHMOO_ITERATIONS);
+    for (; level < num_levels; level++, mhz = SHMOO_MIN_MHZ)
+    {
+        for (; mhz <= SHMOO_MAX_MHZ; mhz += SHMOO_STEP_MHZ)
+        {
+            words[0] = ((ee_u32)SHMOO_MAGIC << 24) | (level << 20) | (mhz << 10);
+            portable_tune_save(words);
+            if (!portable_tune_set(levels[level].vsel, mhz))
+            {
+                shmoo_point(chip, levels[level].mv, mhz, "clock", 0);
+                continue;
+            }
+            start = barebones_clock();
+            kind  = portable_tune_run(SHMOO_ITERATIONS);
+            secs  = time_in_secs(barebones_clock() - start);
+            shmoo_point(chip,
+                        levels[level].mv,
+                        mhz,
+                        kernel[kind],
+                        secs > 0 ? SHMOO_ITERATIONS / (secs * mhz) : 0);
+        }
+    }
+    portable_tune_set(levels[num_levels - 1].vsel, TUNE_MIN_MHZ);
+    words[0] = 0;
+    portable_tune_save(words);
+}
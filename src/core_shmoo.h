@@ -0,0 +1,54 @@
+/**
+ * @file      core_shmoo.h
+ *
+ * @brief Voltage by clock characterisation grid
+ */
+
+/* Topic : Description
+        <core_shmoo_run> runs one checked run at every clock from
+   SHMOO_MIN_MHZ to SHMOO_MAX_MHZ in SHMOO_STEP_MHZ steps, at each voltage
+   level the port lists, through the same device side as <core_tune.h>. Each
+   point is printed as it finishes, as one comma separated line:
+
+        shmoo,<chip>,<mV>,<MHz>,<result>,<CoreMark/MHz>,<temperature>
+
+   where chip is the unique ID the port reports for the board, and result is
+   pass, the kernel that went wrong (list, matrix or state), hang when the
+   watchdog had to reboot the chip, or clock when the clock cannot be made.
+   The temperature is left empty when the board has no sensor. Lines start
+   with "shmoo," so they can be picked out of a console log, and
+   tools/shmoo_render.c turns them into an ASCII or SVG plot.
+
+        The point under test is saved through <portable_tune_save> first, so
+   after a hang the grid carries on from the next point.
+*/
+#ifndef CORE_SHMOO_H
+#define CORE_SHMOO_H
+
+#include "core_portme.h"
+#include "core_tune.h"
+
+#ifndef SHMOO_MIN_MHZ
+#define SHMOO_MIN_MHZ TUNE_MIN_MHZ
+#endif
+#ifndef SHMOO_MAX_MHZ
+#define SHMOO_MAX_MHZ 600 /* Below 1024 */
+#endif
+#ifndef SHMOO_STEP_MHZ
+#define SHMOO_STEP_MHZ 30
+#endif
+#ifndef SHMOO_ITERATIONS
+#define SHMOO_ITERATIONS TUNE_ITERATIONS /* Iterations of the run at a point */
+#endif
+
+#define SHMOO_MAGIC 0x5b
+
+ee_u32 core_shmoo_resumable(const ee_u32 *words);
+void   core_shmoo_run(const core_tune_level *levels,
+                      ee_u32                 num_levels,
+                      const ee_u32 *         resume);
+
+/* provided by the port, a printable ID unique to the board */
+void portable_chip_id(char *id, ee_u32 size);
+
+#endif /* CORE_SHMOO_H */
@@ -0,0 +1,124 @@
+/**
+ * @file      core_stream.c
+ *
+ * @brief Continuous streaming run with a sliding window score
+ */
+
+/* Topic : Description
+        Instead of timing one fixed block, streaming mode runs <iterate> in
+   windows of STREAM_WINDOW_ITERATIONS on every context, forever. After each
+   window it prints the window and sliding iterations/sec, the temperature and
+   whether the window's CRCs still match, so degradation during a thermal run
+   is visible before a crash. With <telemetry_on> each window is sent as a
+   telemetry frame instead of the line.
+*/
+#include "coremark.h"
+#if CORE_TELEMETRY
+#include "core_telemetry.h"
+#endif
+
+#if (STREAM_WINDOW_ITERATIONS > 0)
+
+/* Function : window_errors
+        Count the CRCs of a context that do not match the reference window.
+   The list, matrix and state CRCs do not depend on the iteration count, so
+   they are checked against the known values when there are any.
+*/
+static ee_u32
+window_errors(core_results *res, core_results *ref, const ee_u16 *known)
+{
+    ee_u32 errors = 0;
+
+    if (res->crc != ref->crc)
+        errors++;
+    if ((res->execs & ID_LIST)
+        && res->crclist != (known ? known[IDX_LIST] : ref->crclist))
+        errors++;
+    if ((res->execs & ID_MATRIX)
+        && res->crcmatrix != (known ? known[IDX_MATRIX] : ref->crcmatrix))
+        errors++;
+    if ((res->execs & ID_STATE)
+        && res->crcstate != (known ? known[IDX_STATE] : ref->crcstate))
+        errors++;
+    return errors;
+}
+
+/* Function : core_stream
+        Run the streaming mode. Does not return.
+
+        The first window of context 0 is the reference for the final CRC,
+   which depends on the iteration count and has no known value.
+*/
+void
+core_stream(core_results *results, ee_u32 num_contexts, const ee_u16 *known)
+{
+    CORE_TICKS  window_ticks[STREAM_SLIDING_WINDOWS];
+    CORE_TICKS  ticks, sliding_ticks;
+    core_results ref;
+    ee_u32      window = 0, filled, i, errors, total_errors = 0;
+    float       temp;
+
+    ee_printf("Streaming %lu iterations per window on %lu contexts\n",
+              (unsigned long)STREAM_WINDOW_ITERATIONS,
+              (unsigned long)num_contexts);
+    while (1)
+    {
+        ticks = run_contexts(results, num_contexts, STREAM_WINDOW_ITERATIONS);
+        if (window == 0)
+            ref = results[0];
+
+        errors = 0;
+        for (i = 0; i < num_contexts; i++)
+            errors += window_errors(&results[i], &ref, known);
+        total_errors += errors;
+
+        window_ticks[window % STREAM_SLIDING_WINDOWS] = ticks;
+        window++;
+        filled = window < STREAM_SLIDING_WINDOWS ? window
+                                                 : STREAM_SLIDING_WINDOWS;
+        sliding_ticks = 0;
+        for (i = 0; i < filled; i++)
+            sliding_ticks += window_ticks[i];
+        temp = read_onboard_temperature();
+
+#if CORE_TELEMETRY
+        if (telemetry_on)
+        {
+            core_telemetry_window(window,
+                                  num_contexts * STREAM_WINDOW_ITERATIONS,
+                                  ticks,
+                                  errors,
+                                  TEMP_KNOWN(temp) ? (ee_s32)(temp * 10.0f) : TELEMETRY_NO_TEMP);
+            continue;
+        }
+#endif
+#if HAS_FLOAT
+        if (TEMP_KNOWN(temp))
+            ee_printf("Stream %lu: %f it/s, sliding %f it/s, Temp = %.02fC, errors %lu (total %lu)\n",
+                      (unsigned long)window,
+                      num_contexts * STREAM_WINDOW_ITERATIONS / time_in_secs(ticks),
+                      num_contexts * STREAM_WINDOW_ITERATIONS * filled
+                          / time_in_secs(sliding_ticks),
+                      (double)temp,
+                      (unsigned long)errors,
+                      (unsigned long)total_errors);
+        else
+            ee_printf("Stream %lu: %f it/s, sliding %f it/s, errors %lu (total %lu)\n",
+                      (unsigned long)window,
+                      num_contexts * STREAM_WINDOW_ITERATIONS / time_in_secs(ticks),
+                      num_contexts * STREAM_WINDOW_ITERATIONS * filled
+                          / time_in_secs(sliding_ticks),
+                      (unsigned long)errors,
+                      (unsigned long)total_errors);
+#else
+        ee_printf("Stream %lu: %lu ticks, sliding %lu ticks, errors %lu (total %lu)\n",
+                  (unsigned long)window,
+                  (unsigned long)ticks,
+                  (unsigned long)(sliding_ticks / filled),
+                  (unsigned long)errors,
+                  (unsigned long)total_errors);
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * @file      core_telemetry.c
+ *
+ * @brief Binary telemetry frames on the console
+ */
+
+#include "coremark.h"
+#include "core_telemetry.h"
+#include "core_crash.h"
+#include "core_log.h"
+#include <stdatomic.h>
+
+ee_u32 telemetry_on;
+
+static atomic_uint telemetry_seq;
+
+static ee_u8 *
+put_u16(ee_u8 *p, ee_u32 v)
+{
+    p[0] = (ee_u8)v;
+    p[1] = (ee_u8)(v >> 8);
+    return p + 2;
+}
+
+static ee_u8 *
+put_u32(ee_u8 *p, ee_u32 v)
+{
+    p = put_u16(p, v);
+    return put_u16(p, v >> 16);
+}
+
+/* Function : cobs_encode
+        Encode <len> bytes of <in> into <out>, which needs room for one byte
+   more per 254 bytes and one more.
+
+        Returns:
+        Bytes of <out> used, none of them zero.
+*/
+static ee_u32
+cobs_encode(const ee_u8 *in, ee_u32 len, ee_u8 *out)
+{
+    ee_u32 code_at = 0, o = 1, i;
+    ee_u8  code    = 1;
+
+    for (i = 0; i < len; i++)
+    {
+        if (in[i] == 0)
+        {
+            out[code_at] = code;
+            code         = 1;
+            code_at      = o++;
+            continue;
+        }
+        out[o++] = in[i];
+        if (++code == 0xff)
+        {
+            out[code_at] = code;
+            code         = 1;
+            code_at      = o++;
+        }
+    }
+    out[code_at] = code;
+    return o;
+}
+
+/* Function : telemetry_send
+        Frame the payload from <payload> to <end> as <type> and queue it on
+   the console. Frames that do not fit the ring are dropped like text, and
+   show as a gap in the sequence numbers.
+*/
+static void
+telemetry_send(ee_u32 type, const ee_u8 *payload, const ee_u8 *end)
+{
+    ee_u8  raw[TELEMETRY_MAX_PAYLOAD + 5];
+    ee_u8  frame[TELEMETRY_MAX_PAYLOAD + 8];
+    ee_u32 len = (ee_u32)(end - payload), n, i;
+    ee_u16 crc = 0;
+
+    raw[0] = (ee_u8)type;
+    put_u16(raw + 1, atomic_fetch_add_explicit(&telemetry_seq, 1, memory_order_relaxed));
+    for (i = 0; i < len; i++)
+        raw[3 + i] = payload[i];
+    for (i = 0; i < len + 3; i++)
+        crc = crcu8(raw[i], crc);
+    put_u16(raw + 3 + len, crc);
+
+    frame[0]     = 0;
+    n            = cobs_encode(raw, len + 5, frame + 1);
+    frame[n + 1] = 0;
+    core_log_write((const char *)frame, n + 2);
+}
+
+/* Function : core_telemetry_window
+        One window of the streaming mode, <iterations> of all contexts
+   together in <ticks>.
+*/
+void
+core_telemetry_window(ee_u32 window, ee_u32 iterations, CORE_TICKS ticks, ee_u32 errors, ee_s32 temp10)
+{
+    ee_u8 buf[TELEMETRY_MAX_PAYLOAD], *p = buf;
+
+    if (!telemetry_on)
+        return;
+    p = put_u32(p, window);
+    p = put_u32(p, iterations);
+    p = put_u32(p, (ee_u32)(time_in_secs(ticks) * 1000000));
+    p = put_u32(p, errors);
+    p = put_u16(p, (ee_u32)temp10);
+    telemetry_send(TELEMETRY_WINDOW, buf, p);
+}
+
+/* Function : core_telemetry_temp
+        One sample of the thermal sampler, <ticks> into the run.
+*/
+void
+core_telemetry_temp(CORE_TICKS ticks, ee_s32 temp10, ee_u32 iterations)
+{
+    ee_u8 buf[TELEMETRY_MAX_PAYLOAD], *p = buf;
+
+    if (!telemetry_on)
+        return;
+    p = put_u32(p, (ee_u32)(time_in_secs(ticks) * 1000));
+    p = put_u16(p, (ee_u32)temp10);
+    p = put_u32(p, iterations);
+    telemetry_send(TELEMETRY_TEMP, buf, p);
+}
+
+/* Function : core_telemetry_error
+        One CRC mismatch of <context> in <kernel>, an index of the kernels or
+   TELEMETRY_KERNEL_FINAL.
+*/
+void
+core_telemetry_error(ee_u32 context, ee_u32 kernel, ee_u32 iteration, ee_u16 got, ee_u16 expected)
+{
+    ee_u8 buf[TELEMETRY_MAX_PAYLOAD], *p = buf;
+
+    if (!telemetry_on)
+        return;
+    *p++ = (ee_u8)context;
+    *p++ = (ee_u8)kernel;
+    p    = put_u32(p, iteration);
+    p    = put_u16(p, got);
+    p    = put_u16(p, expected);
+    telemetry_send(TELEMETRY_ERROR, buf, p);
+}
+
+/* Function : core_telemetry_crash
+        The decoded record of a crash, field by field in the order of
+   <core_crash>.
+*/
+void
+core_telemetry_crash(const core_crash *c)
+{
+    ee_u8  buf[TELEMETRY_MAX_PAYLOAD], *p = buf;
+    ee_u32 i;
+
+    if (!telemetry_on)
+        return;
+    p = put_u32(p, c->cause);
+    p = put_u32(p, c->core);
+    p = put_u32(p, c->pc);
+    p = put_u32(p, c->lr);
+    p = put_u32(p, c->cfsr);
+    p = put_u32(p, c->hfsr);
+    for (i = 0; i < CRASH_CONTEXTS; i++)
+        p = put_u32(p, c->iteration[i]);
+    p = put_u32(p, c->mhz);
+    p = put_u32(p, c->vsel);
+    p = put_u32(p, (ee_u32)c->temp10);
+    telemetry_send(TELEMETRY_CRASH, buf, p);
+}
+
+/* Function : core_telemetry_result
+        The result of a pass, the score in thousandths.
+*/
+void
+core_telemetry_result(secs_ret score, ee_u32 contexts, ee_u32 iterations, ee_s16 errors)
+{
+    ee_u8 buf[TELEMETRY_MAX_PAYLOAD], *p = buf;
+
+    if (!telemetry_on)
+        return;
+    p = put_u32(p, (ee_u32)(score * 1000));
+    p = put_u32(p, contexts);
+    p = put_u32(p, iterations);
+    p = put_u16(p, (ee_u32)errors);
+    telemetry_send(TELEMETRY_RESULT, buf, p);
+}
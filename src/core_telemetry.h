@@ -0,0 +1,70 @@
+/**
+ * @file      core_telemetry.h
+ *
+ * @brief Binary telemetry frames on the console
+ */
+
+/* Topic : Description
+        With CORE_TELEMETRY, and <telemetry_on> set at run time, the events a
+   long unattended run produces are also sent as binary frames on the
+   console, between the text, so a host can follow a board over a noisy
+   serial line without parsing the report:
+
+        window - per streaming window: iterations of all contexts, time in
+        microseconds, CRC errors and temperature, TELEMETRY_NO_TEMP without
+        a sensor.
+        temp - per sample of the thermal sampler: milliseconds into the run,
+        temperature and iterations done.
+        error - per CRC mismatch: context, kernel, iteration when known, the
+        CRC seen and the one expected, both 0 for a divergence caught by the
+        iteration check.
+        crash - the record a crash left before the reboot.
+        result - per pass: score, contexts, iterations and errors.
+
+        A frame is a type byte, a 16 bit sequence number, the payload and a
+   CRC16 of all of them (<crcu8>), all little endian, COBS encoded so it
+   holds no zero byte, with a zero byte before and after. Text never holds
+   a zero byte, so the host resynchronises on the next zero whatever was
+   lost, and the sequence numbers tell it how many frames were. Each frame
+   is one record of <core_log_write>, so it never interleaves with text.
+
+        tools/telemetry_decode.c reads them back on the host.
+*/
+#ifndef CORE_TELEMETRY_H
+#define CORE_TELEMETRY_H
+
+#include "core_portme.h"
+
+struct CORE_CRASH_S;
+
+enum CORE_TELEMETRY_TYPE
+{
+    TELEMETRY_WINDOW = 1,
+    TELEMETRY_TEMP,
+    TELEMETRY_ERROR,
+    TELEMETRY_CRASH,
+    TELEMETRY_RESULT
+};
+
+#define TELEMETRY_KERNEL_FINAL  3          /* Kernel of an error in the final CRC */
+#define TELEMETRY_NO_ITERATION  0xffffffff /* Iteration of an error not known */
+#define TELEMETRY_NO_TEMP       -32768     /* Temperature of a window not known */
+#define TELEMETRY_MAX_PAYLOAD   48
+
+extern ee_u32 telemetry_on;
+
+void core_telemetry_window(ee_u32     window,
+                           ee_u32     iterations,
+                           CORE_TICKS ticks,
+                           ee_u32     errors,
+                           ee_s32     temp10);
+void core_telemetry_temp(CORE_TICKS ticks, ee_s32 temp10, ee_u32 iterations);
+void core_telemetry_error(ee_u32 context,
+                          ee_u32 kernel,
+                          ee_u32 iteration,
+                          ee_u16 got,
+                          ee_u16 expected);
+void core_telemetry_crash(const struct CORE_CRASH_S *c);
+void core_telemetry_result(secs_ret score, ee_u32 contexts, ee_u32 iterations, ee_s16 errors);
+
+#endif /* CORE_TELEMETRY_H */
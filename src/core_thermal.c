@@ -0,0 +1,259 @@
+/**
+ * @file      core_thermal.c
+ *
+ * @brief Temperature time series of the timed run, with a thermal limit
+ */
+
+#include "coremark.h"
+#include "core_thermal.h"
+#if CORE_TELEMETRY
+#include "core_telemetry.h"
+#endif
+#if CORE_ITERATION_HISTOGRAM
+#include "core_histogram.h"
+#endif
+#if CORE_CRASH_RECORD
+#include "core_crash.h"
+#endif
+
+core_thermal core_thermal_run;
+ee_s32       thermal_limit10 = THERMAL_LIMIT_C10;
+ee_u32       thermal_hold    = THERMAL_HOLD;
+ee_u32       thermal_overhead = THERMAL_OVERHEAD;
+
+/* Function : core_thermal_start
+        Start keeping samples, and acting on the limit, for a run of
+   <results>.
+*/
+void
+core_thermal_start(core_results *results, ee_u32 num_contexts)
+{
+    core_thermal *t = &core_thermal_run;
+
+    t->hold         = 0;
+    t->abort        = 0;
+    t->timeout      = 0;
+    t->results      = results;
+    t->num_contexts = num_contexts;
+    t->held         = 0;
+    t->trips        = 0;
+    t->peak10       = -2730;
+    t->count        = 0;
+    t->dropped      = 0;
+    t->iterations   = 0;
+    t->start        = barebones_clock();
+    t->active       = 1;
+}
+
+/* Function : core_thermal_stop
+        Stop keeping samples, releasing any held context, and clear the
+   abort so later runs are not cut short.
+*/
+void
+core_thermal_stop(void)
+{
+    core_thermal *t = &core_thermal_run;
+
+    t->active  = 0;
+    t->aborted = t->abort;
+    t->abort   = 0;
+    if (t->hold)
+        t->held += barebones_clock() - t->hold_start;
+    t->hold = 0;
+}
+
+/* Function : core_thermal_sample
+        Called by the port's sampler, from an interrupt or its own thread,
+   with the temperature in tenths of a degree C. Samples outside the timed
+   run are ignored.
+*/
+void
+core_thermal_sample(ee_s32 temp10)
+{
+    core_thermal       *t = &core_thermal_run;
+    core_thermal_point *s;
+    CORE_TICKS          now;
+    ee_u32              i, iterations = 0;
+
+    if (!t->active)
+        return;
+    now = barebones_clock();
+    if (temp10 > t->peak10)
+        t->peak10 = temp10;
+#if CORE_ITERATION_HISTOGRAM
+    for (i = 0; i < t->num_contexts; i++)
+        if (t->results[i].hist)
+            iterations += t->results[i].hist->samples;
+#elif CORE_CRASH_RECORD
+    for (i = 0; i < t->num_contexts; i++)
+        if (t->results[i].crash_iteration && *t->results[i].crash_iteration != CRASH_IDLE)
+            iterations += *t->results[i].crash_iteration;
+#else
+    (void)i;
+#endif
+    /* held or finished contexts show as idle, not as having done nothing */
+    if (iterations < t->iterations)
+        iterations = t->iterations;
+    t->iterations = iterations;
+    if (t->count < THERMAL_SAMPLES)
+    {
+        s             = &t->series[t->count++];
+        s->ticks      = now - t->start;
+        s->temp10     = temp10;
+        s->iterations = iterations;
+    }
+    else
+        t->dropped++;
+#if CORE_TELEMETRY
+    core_telemetry_temp(now - t->start, temp10, iterations);
+#endif
+
+    if (temp10 >= thermal_limit10)
+    {
+        if (!t->hold && !t->abort)
+        {
+            t->trips++;
+            t->hold_start = now;
+            if (thermal_hold)
+                t->hold = 1;
+            else
+                t->abort = 1;
+        }
+    }
+    else if (t->hold && temp10 <= thermal_limit10 - THERMAL_HYSTERESIS_C10)
+    {
+        t->held += now - t->hold_start;
+        t->hold = 0;
+    }
+}
+
+/* Function : core_thermal_wait
+        Called by a context between iterations while it is held, waits until
+   the hold is released, or aborts the run once the hold has lasted
+   THERMAL_HOLD_MAX_SECS.
+
+        Returns:
+        Ticks waited, to be taken out of the context's time.
+*/
+CORE_TICKS
+core_thermal_wait(void)
+{
+    core_thermal *t     = &core_thermal_run;
+    CORE_TICKS    start = barebones_clock(), now = start;
+
+    while (t->hold && !t->abort)
+    {
+        now = barebones_clock();
+        if (time_in_secs(now - t->hold_start) >= THERMAL_HOLD_MAX_SECS)
+        {
+            t->timeout = 1;
+            t->abort   = 1;
+        }
+    }
+    return now - start;
+}
+
+/* Function : core_thermal_report
+        Print the series of the last run and what the limit did.
+
+        Returns:
+        1 when the run was aborted, so its result is not valid, else 0.
+*/
+ee_s16
+core_thermal_report(void)
+{
+    core_thermal *t = &core_thermal_run;
+    ee_u32        i;
+
+    /* no samples, as without a sensor, and no series */
+    if (t->count == 0)
+        return 0;
+    ee_printf("thermal,secs,temp_c,iterations\n");
+    for (i = 0; i < t->count; i++)
+        ee_printf("thermal,%.2f,%.1f,%lu\n",
+                  (double)time_in_secs(t->series[i].ticks),
+                  t->series[i].temp10 / 10.0,
+                  (unsigned long)t->series[i].iterations);
+    ee_printf("Temperature      : peak %.1fC, limit %.1fC, %lu samples",
+              t->peak10 / 10.0,
+              thermal_limit10 / 10.0,
+              (unsigned long)t->count);
+    if (t->dropped)
+        ee_printf(", %lu not kept", (unsigned long)t->dropped);
+    ee_printf("\n");
+    if (t->aborted && t->timeout)
+    {
+        ee_printf("ERROR! Run aborted, held at the thermal limit for %d secs without cooling\n",
+                  THERMAL_HOLD_MAX_SECS);
+        return 1;
+    }
+    if (t->aborted)
+    {
+        ee_printf("ERROR! Run aborted at the thermal limit after %.2f secs\n",
+                  (double)time_in_secs(t->hold_start - t->start));
+        return 1;
+    }
+    if (t->trips)
+        ee_printf("Thermal hold     : %lu times, %.2f secs in all\n",
+                  (unsigned long)t->trips,
+                  (double)time_in_secs(t->held));
+    return 0;
+}
+
+/* Function : core_thermal_overhead
+        Run <iterations> / THERMAL_OVERHEAD_DIV THERMAL_OVERHEAD_PAIRS times
+   with the sampler off and as many with it on, the order turned around
+   every pair so a drift of the clock or the temperature falls on both, and
+   print how much slower the sampled runs were, with the fastest and slowest
+   pair. This leaves the CRCs of <results> meaningless.
+*/
+void
+core_thermal_overhead(core_results *results, ee_u32 num_contexts, ee_u32 iterations)
+{
+    secs_ret off = 0, on = 0, rate_off, rate_on, pct, lo = 0, hi = 0;
+    ee_u32   p;
+
+    iterations /= THERMAL_OVERHEAD_DIV;
+    if (iterations == 0)
+        iterations = 1;
+    for (p = 0; p < THERMAL_OVERHEAD_PAIRS; p++)
+    {
+        if (p & 1)
+        {
+            portable_thermal_enable(1);
+            run_contexts(results, num_contexts, iterations);
+            rate_on = aggregate_rate(results, num_contexts);
+            portable_thermal_enable(0);
+            run_contexts(results, num_contexts, iterations);
+            rate_off = aggregate_rate(results, num_contexts);
+        }
+        else
+        {
+            portable_thermal_enable(0);
+            run_contexts(results, num_contexts, iterations);
+            rate_off = aggregate_rate(results, num_contexts);
+            portable_thermal_enable(1);
+            run_contexts(results, num_contexts, iterations);
+            rate_on = aggregate_rate(results, num_contexts);
+        }
+        if (rate_off <= 0)
+            break;
+        pct = 100 * (rate_off - rate_on) / rate_off;
+        if (p == 0 || pct < lo)
+            lo = pct;
+        if (p == 0 || pct > hi)
+            hi = pct;
+        off += rate_off;
+        on += rate_on;
+    }
+    portable_thermal_enable(1);
+    if (p == 0 || off <= 0)
+        return;
+    ee_printf("Sampler overhead : %.2f%% (%.2f%% to %.2f%% over %lu pairs, %.1f iterations/sec sampled, %.1f not)\n",
+              (double)(100 * (off - on) / off),
+              (double)lo,
+              (double)hi,
+              (unsigned long)p,
+              (double)(on / p),
+              (double)(off / p));
+}
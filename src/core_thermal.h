@@ -0,0 +1,129 @@
+/**
+ * @file      core_thermal.h
+ *
+ * @brief Temperature time series of the timed run, with a thermal limit
+ */
+
+/* Topic : Description
+        The port samples the temperature in the background, away from the
+   code of the contexts, and passes every sample to <core_thermal_sample>.
+   While the timed run is on, each sample is kept with the time and the
+   iterations done so far, and <core_thermal_report> prints them after the
+   run as lines of
+
+        thermal,<secs>,<temp_c>,<iterations>
+
+   The iterations come from the latency histograms or the crash record of
+   each context, and are 0 when the build keeps neither.
+
+   At or above <thermal_limit10> the run is aborted, or with <thermal_hold>
+   the contexts wait between iterations until it has cooled by
+   THERMAL_HYSTERESIS_C10. The wait is taken out of each context's time. A
+   held context shows as idle to the crash record, so the hang watchdog
+   does not take the wait for a hang, and a hold longer than
+   THERMAL_HOLD_MAX_SECS aborts the run instead.
+
+        When <thermal_overhead> is set, <core_thermal_overhead> runs the
+   benchmark with the sampler off and on, through <portable_thermal_enable>,
+   THERMAL_OVERHEAD_PAIRS times each in turn, and prints what it costs with
+   the spread between the pairs. A cost inside the spread is noise. It is
+   off by default, as it takes as long as six more passes.
+
+        A port without a sensor reads NaN, the sampler passes nothing on, and
+   the series and the temperature fields of the record are left out.
+*/
+#ifndef CORE_THERMAL_H
+#define CORE_THERMAL_H
+
+#include "core_portme.h"
+
+#ifndef THERMAL_SAMPLES
+#define THERMAL_SAMPLES 256 /* Samples kept per run, later ones are counted */
+#endif
+#ifndef THERMAL_PERIOD_MS
+#define THERMAL_PERIOD_MS 500 /* Sample period of the port's sampler */
+#endif
+#ifndef THERMAL_LIMIT_C10
+#define THERMAL_LIMIT_C10 850 /* Default limit, in tenths of a degree C */
+#endif
+#ifndef THERMAL_HYSTERESIS_C10
+#define THERMAL_HYSTERESIS_C10 50 /* Cooling before held contexts go on */
+#endif
+#ifndef THERMAL_HOLD
+#define THERMAL_HOLD 0 /* Default action at the limit: 0 abort, 1 hold */
+#endif
+#ifndef THERMAL_HOLD_MAX_SECS
+#define THERMAL_HOLD_MAX_SECS 60 /* Longest hold before the run is aborted */
+#endif
+#ifndef THERMAL_OVERHEAD
+#define THERMAL_OVERHEAD 0 /* Default: 1 to measure the sampler overhead */
+#endif
+#ifndef THERMAL_OVERHEAD_DIV
+#define THERMAL_OVERHEAD_DIV 1 /* Overhead runs are this much shorter */
+#endif
+#ifndef THERMAL_OVERHEAD_PAIRS
+#define THERMAL_OVERHEAD_PAIRS 3 /* Interleaved runs with the sampler off and on */
+#endif
+
+struct RESULTS_S;
+
+typedef struct CORE_THERMAL_POINT_S
+{
+    CORE_TICKS ticks;      /* Since the start of the run */
+    ee_s32     temp10;     /* Tenths of a degree C */
+    ee_u32     iterations; /* Done by all contexts */
+} core_thermal_point;
+
+typedef struct CORE_THERMAL_S
+{
+    volatile ee_u32     active; /* The timed run is on */
+    volatile ee_u32     hold;   /* Contexts wait before the next iteration */
+    volatile ee_u32     abort;  /* Contexts stop */
+    ee_u32              aborted; /* The last run was aborted */
+    volatile ee_u32     timeout; /* It was aborted by a hold too long */
+    struct RESULTS_S   *results;
+    ee_u32              num_contexts;
+    CORE_TICKS          start;
+    CORE_TICKS          hold_start;
+    CORE_TICKS          held;  /* Ticks the contexts were held */
+    ee_u32              trips; /* Times the limit was reached */
+    ee_s32              peak10;
+    ee_u32              count;
+    ee_u32              dropped; /* Samples past THERMAL_SAMPLES */
+    ee_u32              iterations; /* Most seen by a sample */
+    core_thermal_point  series[THERMAL_SAMPLES];
+} core_thermal;
+
+extern core_thermal core_thermal_run;
+
+/* Variable : thermal_limit10
+        Limit in tenths of a degree C, THERMAL_LIMIT_C10 unless the port
+   sets it.
+*/
+extern ee_s32 thermal_limit10;
+
+/* Variable : thermal_hold
+        Non zero to hold the contexts at the limit instead of aborting,
+   THERMAL_HOLD unless the port sets it.
+*/
+extern ee_u32 thermal_hold;
+
+/* Variable : thermal_overhead
+        Non zero to measure the overhead of the sampler after the first
+   pass, THERMAL_OVERHEAD unless the port sets it.
+*/
+extern ee_u32 thermal_overhead;
+
+void       core_thermal_start(struct RESULTS_S *results, ee_u32 num_contexts);
+void       core_thermal_stop(void);
+void       core_thermal_sample(ee_s32 temp10);
+CORE_TICKS core_thermal_wait(void);
+ee_s16     core_thermal_report(void);
+void       core_thermal_overhead(struct RESULTS_S *results,
+                                 ee_u32            num_contexts,
+                                 ee_u32            iterations);
+
+/* Port side: start or stop the background sampler */
+void portable_thermal_enable(ee_u32 on);
+
+#endif /* CORE_THERMAL_H */
@@ -0,0 +1,25 @@
+/**
+ * @file      core_timebase.c
+ *
+ * @brief Extension of a free running 32 bit counter to a 64 bit timebase
+ */
+
+#include "core_timebase.h"
+
+/* Function : core_timebase_extend
+        Extend a raw 32 bit counter value to 64 bits.
+
+        The raw counter only ever counts up, so a value lower than the last
+   one observed means the counter has wrapped. Callers sharing a timebase
+   between cores or with an IRQ must serialise the read of the raw counter
+   together with this call, otherwise an older value can be applied after a
+   newer one and be taken for a wrap.
+*/
+ee_u64
+core_timebase_extend(core_timebase *tb, ee_u32 raw)
+{
+    if (raw < tb->last)
+        tb->wraps++;
+    tb->last = raw;
+    return ((ee_u64)tb->wraps << 32) | raw;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file      core_timebase.h
+ *
+ * @brief Extension of a free running 32 bit counter to a 64 bit timebase
+ */
+
+/* Topic : Description
+        The reference clock counter in <counter.pio> is only 32 bits wide and
+   wraps after ~71 minutes of a 1MHz reference. The helpers here extend each
+   raw read to 64 bits by counting wraps. The counter must be observed at least
+   once per wrap period, which the port guarantees from a periodic IRQ.
+
+        This file has no hardware dependencies so that it can also be built
+   on a host against a simulated counter.
+*/
+#ifndef CORE_TIMEBASE_H
+#define CORE_TIMEBASE_H
+
+#include "core_portme.h"
+
+typedef struct CORE_TIMEBASE_S
+{
+    ee_u32 last;  /* Last raw counter value observed */
+    ee_u32 wraps; /* Number of times the raw counter has wrapped */
+} core_timebase;
+
+/* A zero initialised timebase is valid and starts counting from raw 0 */
+#define CORE_TIMEBASE_INIT { 0, 0 }
+
+ee_u64 core_timebase_extend(core_timebase *tb, ee_u32 raw);
+
+#endif /* CORE_TIMEBASE_H */
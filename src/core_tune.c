@@ -0,0 +1,231 @@
+/**
+ * @file      core_tune.c
+ *
+ * @brief Search for the highest stable clock at each core voltage
+ */
+
+#include "coremark.h"
+#include "core_golden.h"
+#include "core_tune.h"
+#include <string.h>
+
+#define TUNE_FIELD(x) ((x) & 0x3ff) /* Clocks are packed in 10 bits */
+
+/* Results every run has to end on, see <core_tune_reference> */
+static ee_u16 tune_crc, tune_crcmatrix, tune_crcstate;
+
+/* Function : core_tune_pack
+        Pack <t> into TUNE_WORDS words: the magic, level, trial and bounds
+   of the search, the best clock of each level in 10 bits, and the last
+   point that passed.
+*/
+void
+core_tune_pack(const core_tune *t, ee_u32 *words)
+{
+    words[0] = ((ee_u32)TUNE_MAGIC << 24) | ((t->level & 0xf) << 20)
+               | (TUNE_FIELD(t->trying) << 10) | TUNE_FIELD(t->lo);
+    words[1] = TUNE_FIELD(t->hi) | (TUNE_FIELD(t->best[0]) << 10)
+               | (TUNE_FIELD(t->best[1]) << 20);
+    words[2] = TUNE_FIELD(t->best[2]) | (TUNE_FIELD(t->best[3]) << 10)
+               | (TUNE_FIELD(t->best[4]) << 20);
+    words[3] = (t->good_vsel << 16) | (t->good_mhz & 0xffff);
+}
+
+/* Function : core_tune_unpack
+        Reverse of <core_tune_pack>.
+
+        Returns:
+        Non zero when <words> hold a saved search.
+*/
+ee_u32
+core_tune_unpack(core_tune *t, const ee_u32 *words)
+{
+    if ((words[0] >> 24) != TUNE_MAGIC)
+        return 0;
+    t->level     = (words[0] >> 20) & 0xf;
+    t->trying    = (words[0] >> 10) & 0x3ff;
+    t->lo        = words[0] & 0x3ff;
+    t->hi        = words[1] & 0x3ff;
+    t->best[0]   = (words[1] >> 10) & 0x3ff;
+    t->best[1]   = (words[1] >> 20) & 0x3ff;
+    t->best[2]   = words[2] & 0x3ff;
+    t->best[3]   = (words[2] >> 10) & 0x3ff;
+    t->best[4]   = (words[2] >> 20) & 0x3ff;
+    t->good_vsel = words[3] >> 16;
+    t->good_mhz  = words[3] & 0xffff;
+    return 1;
+}
+
+/* Function : core_tune_start
+        Set <t> up for a new search from the first level.
+*/
+void
+core_tune_start(core_tune *t)
+{
+    memset(t, 0, sizeof(*t));
+}
+
+/* Function : tune_iterations
+        Run <iterations> iterations of the performance seeds over a fresh
+   2K block, leaving the CRCs in <res>.
+*/
+static void
+tune_iterations(core_results *res, ee_u32 iterations)
+{
+    void * block = portable_malloc(TOTAL_DATA_SIZE);
+    ee_u32 i;
+
+    memset(res, 0, sizeof(*res));
+    res->seed3 = 0x66;
+    res->execs = ALL_ALGORITHMS_MASK;
+    core_golden_init(res, block, TOTAL_DATA_SIZE);
+    for (i = 0; i < iterations; i++)
+        core_golden_iteration(res);
+    portable_free(block);
+}
+
+/* Function : core_tune_reference
+        Compute the results runs of <iterations> are checked against, at the
+   current clock, which has to be stable.
+*/
+void
+core_tune_reference(ee_u32 iterations)
+{
+    core_results res;
+
+    tune_iterations(&res, iterations);
+    tune_crc       = res.crc;
+    tune_crcmatrix = res.crcmatrix;
+    tune_crcstate  = res.crcstate;
+}
+
+/* Function : core_tune_check
+        One checked run, for <portable_tune_run>.
+
+        Returns:
+        0 when the run matched the reference, else the ID of the kernel that
+        went wrong: the matrix or state result of the last iteration, or the
+        list when only the running CRC differs.
+*/
+ee_u32
+core_tune_check(ee_u32 iterations)
+{
+    core_results res;
+
+    tune_iterations(&res, iterations);
+    if (res.crcmatrix != tune_crcmatrix)
+        return ID_MATRIX;
+    if (res.crcstate != tune_crcstate)
+        return ID_STATE;
+    if (res.crc != tune_crc)
+        return ID_LIST;
+    return 0;
+}
+
+/* Function : tune_trial
+        Try <mhz> at the current level, saving the state first so a reboot
+   during the trial counts it as unstable.
+
+        Returns:
+        Non zero when every run passed.
+*/
+static ee_u32
+tune_trial(core_tune *t, const core_tune_level *level, ee_u32 mhz)
+{
+    ee_u32 words[TUNE_WORDS], passed = 0;
+
+    t->trying = mhz;
+    core_tune_pack(t, words);
+    portable_tune_save(words);
+    if (portable_tune_set(level->vsel, mhz))
+        while (passed < TUNE_RUNS && portable_tune_run(TUNE_ITERATIONS) == 0)
+            passed++;
+    portable_tune_set(level->vsel, TUNE_MIN_MHZ);
+    ee_printf("Tune %4lumV    : %3lu MHz, %lu/%u runs clean\n",
+              (unsigned long)level->mv,
+              (unsigned long)mhz,
+              (unsigned long)passed,
+              TUNE_RUNS);
+    t->trying = 0;
+    if (passed < TUNE_RUNS)
+        return 0;
+    t->good_vsel = level->vsel;
+    t->good_mhz  = mhz;
+    return 1;
+}
+
+/* Function : core_tune_search
+        Search every level from where <t> left off. A saved trial in <t>
+   means the chip rebooted during it, so that clock is the new upper bound.
+   Levels past TUNE_MAX_LEVELS are not searched.
+*/
+void
+core_tune_search(core_tune *t, const core_tune_level *levels, ee_u32 num_levels)
+{
+    ee_u32 words[TUNE_WORDS], mid, steps;
+
+    if (num_levels > TUNE_MAX_LEVELS)
+        num_levels = TUNE_MAX_LEVELS;
+    if (t->level >= num_levels)
+        return;
+    if (t->trying)
+    {
+        ee_printf("Tune           : rebooted trying %lu MHz, continuing\n",
+                  (unsigned long)t->trying);
+        t->hi     = t->trying;
+        t->trying = 0;
+    }
+    /* the floor is assumed stable, so the reference is computed there */
+    portable_tune_set(levels[t->level].vsel, TUNE_MIN_MHZ);
+    core_tune_reference(TUNE_ITERATIONS);
+
+    for (; t->level < num_levels; t->level++)
+    {
+        if (t->hi == 0)
+        {
+            t->lo = TUNE_MIN_MHZ;
+            if (t->level > 0 && t->best[t->level - 1] > t->lo)
+                t->lo = t->best[t->level - 1];
+            t->hi = TUNE_MAX_MHZ + TUNE_STEP_MHZ;
+        }
+        /* in whole steps from lo, so mid always lies strictly between the
+         * bounds, even when a saved state left them off the grid */
+        while (t->hi > t->lo + TUNE_STEP_MHZ)
+        {
+            steps = (t->hi - t->lo) / TUNE_STEP_MHZ;
+            mid   = t->lo + (steps / 2 ? steps / 2 : 1) * TUNE_STEP_MHZ;
+            if (tune_trial(t, &levels[t->level], mid))
+                t->lo = mid;
+            else
+                t->hi = mid;
+        }
+        t->best[t->level] = t->lo;
+        t->hi             = 0;
+    }
+    core_tune_pack(t, words);
+    portable_tune_save(words);
+}
+
+/* Function : core_tune_report
+        Print the best clock found at each level and the last point that
+   passed.
+*/
+void
+core_tune_report(const core_tune *t, const core_tune_level *levels, ee_u32 num_levels)
+{
+    ee_u32 i;
+
+    if (num_levels > TUNE_MAX_LEVELS)
+        num_levels = TUNE_MAX_LEVELS;
+    ee_printf("Voltage  Max stable clock (%u runs of %u iterations)\n",
+              TUNE_RUNS,
+              TUNE_ITERATIONS);
+    for (i = 0; i < num_levels && i < t->level; i++)
+        ee_printf("%4lumV  %4lu MHz\n",
+                  (unsigned long)levels[i].mv,
+                  (unsigned long)t->best[i]);
+    if (t->good_mhz)
+        ee_printf("Last good      : setting %lu at %lu MHz\n",
+                  (unsigned long)t->good_vsel,
+                  (unsigned long)t->good_mhz);
+}
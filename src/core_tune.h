@@ -0,0 +1,101 @@
+/**
+ * @file      core_tune.h
+ *
+ * @brief Search for the highest stable clock at each core voltage
+ */
+
+/* Topic : Description
+        For each voltage level the port lists, <core_tune_search> binary
+   searches clk_sys between the best clock of the previous level (or
+   TUNE_MIN_MHZ) and TUNE_MAX_MHZ, in TUNE_STEP_MHZ steps. A point is stable
+   when TUNE_RUNS runs of TUNE_ITERATIONS iterations all end on the CRCs of
+   a reference computed before the search, at the clock it starts from.
+
+        The search state is saved through the port before every trial, packed
+   into four words (see <core_tune_pack>) so it fits the watchdog scratch
+   registers of the RP2. If a trial hangs or faults and the watchdog reboots
+   the chip, the port loads the state back and the search goes on, with the
+   point it was trying counted as unstable.
+
+        The port provides the device side:
+
+        portable_tune_set - set the voltage and clock of a trial.
+        portable_tune_run - one checked run at that point, usually
+        <core_tune_check>.
+        portable_tune_save / portable_tune_load - keep the state across a
+        reboot.
+
+   The POSIX port implements these against a simulated device, so the search
+   can be run on the host.
+*/
+#ifndef CORE_TUNE_H
+#define CORE_TUNE_H
+
+#include "core_portme.h"
+
+#ifndef TUNE_RUNS
+#define TUNE_RUNS 3 /* Clean runs for a point to count as stable */
+#endif
+#ifndef TUNE_ITERATIONS
+#define TUNE_ITERATIONS 500 /* Iterations of one run */
+#endif
+#ifndef TUNE_MIN_MHZ
+#define TUNE_MIN_MHZ 150 /* Assumed stable at every level */
+#endif
+#ifndef TUNE_MAX_MHZ
+#define TUNE_MAX_MHZ 720 /* Highest clock tried, below 1024 */
+#endif
+#ifndef TUNE_STEP_MHZ
+#define TUNE_STEP_MHZ 6 /* Resolution of the search */
+#endif
+
+#if (TUNE_STEP_MHZ) < 1 || (TUNE_MAX_MHZ) < (TUNE_MIN_MHZ)
+#error "TUNE_STEP_MHZ must be positive and TUNE_MAX_MHZ at least TUNE_MIN_MHZ"
+#endif
+#if ((TUNE_MAX_MHZ) - (TUNE_MIN_MHZ)) % (TUNE_STEP_MHZ)
+#error "TUNE_MAX_MHZ must be TUNE_MIN_MHZ plus a whole number of TUNE_STEP_MHZ"
+#endif
+#if (TUNE_MAX_MHZ) + (TUNE_STEP_MHZ) > 0x3ff
+#error "TUNE_MAX_MHZ + TUNE_STEP_MHZ must fit the 10 bits of the packed state"
+#endif
+
+#define TUNE_MAX_LEVELS 5  /* Levels the packed state has room for */
+#define TUNE_WORDS      4  /* Words of packed state */
+#define TUNE_MAGIC      0x5a
+
+typedef struct CORE_TUNE_LEVEL_S
+{
+    ee_u32 vsel; /* Port specific voltage setting */
+    ee_u32 mv;   /* Nominal voltage, for the table */
+} core_tune_level;
+
+typedef struct CORE_TUNE_S
+{
+    ee_u32 level;                 /* Index of the level being searched */
+    ee_u32 lo;                    /* Highest clock known stable */
+    ee_u32 hi;                    /* Lowest clock known unstable */
+    ee_u32 trying;                /* Clock under trial, 0 between trials */
+    ee_u32 best[TUNE_MAX_LEVELS]; /* Result of each finished level */
+    ee_u32 good_vsel;             /* Last point that passed */
+    ee_u32 good_mhz;
+} core_tune;
+
+void   core_tune_pack(const core_tune *t, ee_u32 *words);
+ee_u32 core_tune_unpack(core_tune *t, const ee_u32 *words);
+void   core_tune_start(core_tune *t);
+void   core_tune_reference(ee_u32 iterations);
+ee_u32 core_tune_check(ee_u32 iterations);
+void   core_tune_search(core_tune *            t,
+                        const core_tune_level *levels,
+                        ee_u32                 num_levels);
+void   core_tune_report(const core_tune *      t,
+                        const core_tune_level *levels,
+                        ee_u32                 num_levels);
+
+/* device side, provided by the port */
+ee_u32 portable_tune_set(ee_u32 vsel, ee_u32 mhz);
+ee_u32 portable_tune_run(ee_u32 iterations);
+void   portable_tune_save(const ee_u32 *words);
+ee_u32 portable_tune_load(ee_u32 *words);
+
+#endif /* CORE_TUNE_H */
@@ -37,6 +37,204 @@ Original Author: Shay Gal-on
 
 #include "core_portme.h"
 
+/* Topic: Harness configuration
+        Defaults for the measurement features of the harness. A port can
+   override any of them in <core_portme.h>.
+*/
+/* Configuration: CORE_KERNEL_TIMING
+        Define to 1 to accumulate the ticks spent in each benchmark kernel
+   while <iterate> runs, so a score change can be attributed to the list,
+   matrix or state kernel. Costs two raw counter reads per iteration and per
+   matrix or state call, inside the timed run, so it is off by default and
+   a score taken with it is not comparable to one without.
+*/
+#ifndef CORE_KERNEL_TIMING
+#define CORE_KERNEL_TIMING 0
+#endif
+
+/* Configuration: TARGET_DURATION_SECS
+        Wall clock duration, in seconds, the timed run is calibrated to when
+   no iteration count is supplied (seed 4 is 0). Calibration runs all contexts
+   in parallel, so the count fits the current core count and clock. Define to 0
+   to use the fixed <FIXED_ITERATIONS> instead.
+*/
+#ifndef TARGET_DURATION_SECS
+#define TARGET_DURATION_SECS 12
+#endif
+#ifndef FIXED_ITERATIONS
+#define FIXED_ITERATIONS 4000
+#endif
+
+/* Configuration: STREAM_WINDOW_ITERATIONS
+        Define to a non zero iteration count to run in streaming mode (see
+   <core_stream.c>) instead of one timed block. A report is printed after
+   every window, with a sliding score over the last STREAM_SLIDING_WINDOWS.
+*/
+#ifndef STREAM_WINDOW_ITERATIONS
+#define STREAM_WINDOW_ITERATIONS 0
+#endif
+#ifndef STREAM_SLIDING_WINDOWS
+#define STREAM_SLIDING_WINDOWS 8
+#endif
+
+/* Configuration: CORE_ITERATION_HISTOGRAM
+        Define to 1 to time every iteration of <iterate> into a per context
+   histogram (see <core_histogram.h>) and report min/p50/p99/max latency, so
+   interrupt and clock instability show up as tail outliers. Costs a raw
+   counter read and a bucket update per iteration inside the timed run, so
+   it is off by default.
+*/
+#ifndef CORE_ITERATION_HISTOGRAM
+#define CORE_ITERATION_HISTOGRAM 0
+#endif
+
+/* Configuration: CORE_ITERATION_CHECK
+        Define to 1 to compare the CRCs of every iteration of <iterate> against
+   the trace generated for the run (see <core_golden.h>), and stop all
+   contexts at the first divergence, reporting the kernel, iteration and
+   context that failed. Runs are checked when the seeds, size and algorithms
+   have a generated entry with an iteration count, for up to that many
+   iterations.
+*/
+#ifndef CORE_ITERATION_CHECK
+#define CORE_ITERATION_CHECK 0
+#endif
+
+/* Configuration: CORE_DIAGNOSE
+        Define to 1, along with <CORE_ITERATION_CHECK>, to snapshot the inputs
+   of every checked iteration and, when one diverges, replay it one kernel
+   step at a time against a reference run at the port's safe clock (see
+   <core_diag.h>). The snapshot costs a copy of the memory block per
+   iteration.
+*/
+#ifndef CORE_DIAGNOSE
+#define CORE_DIAGNOSE 0
+#endif
+#if CORE_DIAGNOSE && !CORE_ITERATION_CHECK
+#error "CORE_DIAGNOSE needs CORE_ITERATION_CHECK"
+#endif
+
+/* Configuration: CORE_CRASH_RECORD
+        Define to 1 to keep the iteration each context is in where the port's
+   fault and hang handlers can record it (see <core_crash.h>). Ports that
+   have such handlers turn it on.
+*/
+#ifndef CORE_CRASH_RECORD
+#define CORE_CRASH_RECORD 0
+#endif
+
+/* Configuration: CORE_THERMAL
+        Define to 1 to keep a time series of the temperature during the timed
+   run from the port's background sampler, and to abort or hold the run at
+   a temperature limit (see <core_thermal.h>). Ports that have such a
+   sampler turn it on.
+*/
+#ifndef CORE_THERMAL
+#define CORE_THERMAL 0
+#endif
+
+/* Configuration: CORE_LOG
+        Define to 1 to have <ee_printf> write into a lock-free ring that the
+   port drains in the background (see <core_log.h>), so no core waits on
+   the console. Ports that drain the ring turn it on.
+*/
+#ifndef CORE_LOG
+#define CORE_LOG 0
+#endif
+
+/* Configuration: CORE_RECORD
+        Define to 1 to print one JSON line per pass with the score, clocks,
+   temperatures, build and per context CRCs (see <core_record.h>), for
+   tools rather than people. Needs HAS_STDIO for vsnprintf, and is on when
+   the port has it.
+*/
+#ifndef CORE_RECORD
+#define CORE_RECORD HAS_STDIO
+#endif
+#if CORE_RECORD && !HAS_STDIO
+#error "CORE_RECORD needs HAS_STDIO"
+#endif
+
+/* Configuration: CORE_CLOCK_MEASURE
+        Define to 1 to measure clk_sys over the timed run against the
+   reference clock and report CoreMark/MHz from it (see <core_clock.h>).
+   Ports that can count cycles turn it on.
+*/
+#ifndef CORE_CLOCK_MEASURE
+#define CORE_CLOCK_MEASURE 0
+#endif
+
+/* Configuration: CORE_BASELINE
+        Define to 1 to report CoreMark, CoreMark/MHz and equivalent MHz after
+   every pass against a calibrated baseline of the build, and flag drift
+   from linear scaling (see <core_baseline.h>). Needs the clock from
+   <CORE_RECORD> and floating point, and is on when both are.
+*/
+#ifndef CORE_BASELINE
+#define CORE_BASELINE (CORE_RECORD && HAS_FLOAT)
+#endif
+#if CORE_BASELINE && !(CORE_RECORD && HAS_FLOAT)
+#error "CORE_BASELINE needs CORE_RECORD and HAS_FLOAT"
+#endif
+
+/* Configuration: CORE_TELEMETRY
+        Define to 1 to be able to send window scores, temperature samples,
+   CRC errors, crash records and results as binary frames on the console
+   (see <core_telemetry.h>). They are only sent once the port sets
+   <telemetry_on>.
+*/
+#ifndef CORE_TELEMETRY
+#define CORE_TELEMETRY 0
+#endif
+
+#if CORE_TELEMETRY && !CORE_LOG
+#error "CORE_TELEMETRY needs CORE_LOG"
+#endif
+
+/* Configuration: CORE_LOCKSTEP
+        Define to 1 to cross check the running CRC of every iteration between
+   contexts as they run (see <core_lockstep.h>), which needs no reference
+   CRCs for the seeds.
+*/
+#ifndef CORE_LOCKSTEP
+#define CORE_LOCKSTEP 0
+#endif
+
+/* Configuration: WORK_STEALING_CHUNK
+        Define to a non zero chunk size to run the timed block through the
+   work stealing scheduler (see <core_sched.h>) instead of giving every
+   context a fixed share of the iterations.
+*/
+#ifndef WORK_STEALING_CHUNK
+#define WORK_STEALING_CHUNK 0
+#endif
+
+/* Configuration: STRESS_LOOP
+        Define to 1 to repeat the whole benchmark forever.
+*/
+#ifndef STRESS_LOOP
+#define STRESS_LOOP 0
+#endif
+
+/* Configuration: PERSISTENT_ARENA
+        Define to 1 to allocate and initialize the memory blocks once and
+   snapshot them. Later passes of the stress loop copy the snapshot back
+   instead of allocating and running the inits again.
+*/
+#ifndef PERSISTENT_ARENA
+#define PERSISTENT_ARENA 1
+#endif
+
+/* Configuration: DATA_SIZE_SWEEP_MAX
+        Default for the port's <data_size_sweep>. When non zero, every pass
+   also reruns the kernels with memory blocks of TOTAL_DATA_SIZE, doubling up
+   to this many bytes per context, and reports the rate and bytes per second
+   of each kernel at each size. Define to 0 to leave the sweep off.
+*/
+#ifndef DATA_SIZE_SWEEP_MAX
+#define DATA_SIZE_SWEEP_MAX 0
+#endif
+
 #if HAS_STDIO
 #include <stdio.h>
 #endif
@@ -70,6 +268,12 @@ void       stop_time(void);
 CORE_TICKS get_time(void);
 secs_ret   time_in_secs(CORE_TICKS ticks);
 
+/* Macro: TEMP_KNOWN
+        Non zero when <t> from read_onboard_temperature is a reading. A port
+   without a sensor returns NaN, which is the only value not equal to itself.
+*/
+#define TEMP_KNOWN(t) ((t) == (t))
+
 /* Misc useful functions */
 ee_u16 crcu8(ee_u8 data, ee_u16 crc);
 ee_u16 crc16(ee_s16 newval, ee_u16 crc);
@@ -86,6 +290,10 @@ ee_s32 parseval(char *valstring);
 #define ID_STATE            (1 << 2)
 #define ALL_ALGORITHMS_MASK (ID_LIST | ID_MATRIX | ID_STATE)
 #define NUM_ALGORITHMS      3
+/* Algorithm indexes, the bit position of each ID */
+#define IDX_LIST   0
+#define IDX_MATRIX 1
+#define IDX_STATE  2
 
 /* list data structures */
 typedef struct list_data_s
@@ -152,6 +360,38 @@ typedef struct RESULTS_S
     ee_u16 crcmatrix;
     ee_u16 crcstate;
     ee_s16 err;
+    CORE_TICKS start_ticks; /* Clock when this context started iterating */
+    CORE_TICKS stop_ticks;  /* Clock when this context finished */
+#if CORE_KERNEL_TIMING
+    CORE_TICKS kernel_ticks[NUM_ALGORITHMS]; /* Ticks spent in each kernel */
+#endif
+#if CORE_ITERATION_HISTOGRAM
+    struct CORE_HISTOGRAM_S *hist; /* Per iteration latency, may be NULL */
+#endif
+#if (WORK_STEALING_CHUNK > 0)
+    struct CORE_SCHED_S *sched; /* Scheduler this context pulls chunks from */
+#endif
+#if CORE_ITERATION_CHECK
+    const struct CORE_GOLDEN_ITER_S *check; /* Expected CRCs, may be NULL */
+    ee_u32 check_iterations; /* Entries in check */
+    ee_u32 fail_kernel;      /* ID of the kernel that diverged, 0 if none */
+    ee_u32 fail_iteration;   /* Iteration it diverged or was stopped in */
+#endif
+#if CORE_DIAGNOSE
+    ee_u8 *diag_block;       /* Memory block at the start of the iteration */
+    ee_u32 diag_size;        /* Bytes in diag_block */
+    ee_u16 diag_crc;         /* Running CRC at the start of the iteration */
+    ee_s16 diag_matrix_seed; /* Arguments of the first matrix call */
+    ee_u16 diag_matrix_crc;
+    ee_s16 diag_state_step;  /* Arguments of the first state call */
+    ee_u16 diag_state_crc;
+#endif
+#if CORE_LOCKSTEP
+    struct CORE_LOCKSTEP_S *lockstep; /* Cross check state, may be NULL */
+#endif
+#if CORE_CRASH_RECORD
+    volatile ee_u32 *crash_iteration; /* Current iteration, may be NULL */
+#endif
     /* ultithread specific */
     core_portable port;
 } core_results;
@@ -163,10 +403,47 @@ extern void core_end_parallel(ee_u16 core_index);
 
 #endif
 
+#if CORE_ITERATION_CHECK
+/* Set by the first context to diverge, stops the others */
+extern volatile ee_u32 core_check_abort;
+#endif
+
+/* Harness run modes */
+CORE_TICKS run_contexts(core_results *results,
+                        ee_u32        num_contexts,
+                        ee_u32        iterations);
+secs_ret   aggregate_rate(core_results *results, ee_u32 num_contexts);
+#if (WORK_STEALING_CHUNK > 0)
+CORE_TICKS core_sched_run(core_results *results,
+                          ee_u32        num_contexts,
+                          ee_u32        iterations);
+void *     core_sched_worker_run(core_results *res);
+#endif
+#if (STREAM_WINDOW_ITERATIONS > 0)
+void core_stream(core_results *results,
+                 ee_u32        num_contexts,
+                 const ee_u16 *known);
+#endif
+
 /* list benchmark functions */
 list_head *core_list_init(ee_u32 blksize, list_head *memblock, ee_s16 seed);
 ee_u16     core_bench_list(core_results *res, ee_s16 finder_idx);
 
+/* Where <core_bench_list> is between its steps */
+typedef struct LIST_BENCH_S
+{
+    list_head *list;
+    list_head *remover; /* Item taken out by the remove step */
+    list_data  info;    /* Last value searched for */
+    ee_u16     retval;
+} list_bench;
+
+#if CORE_DIAGNOSE
+/* Steps of <core_bench_list>, run one at a time by the replay */
+#define LIST_BENCH_STEPS 5
+void core_list_bench_step(list_bench *b, int step, core_results *res, ee_s16 finder_idx);
+#endif
+
 /* state benchmark functions */
 void   core_init_state(ee_u32 size, ee_s16 seed, ee_u8 *p);
 ee_u16 core_bench_state(ee_u32 blksize,
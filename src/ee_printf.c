@@ -16,7 +16,12 @@ limitations under the License.
 
 #include "coremark.h"
 #include <stdarg.h>
+#if CORE_LOG
+#include "core_log.h"
+#endif
 
+#if !(CORE_LOG && HAS_STDIO)
+/* With the console ring and a C library, vsnprintf formats instead */
 #define ZEROPAD   (1 << 0) /* Pad with zero */
 #define SIGN      (1 << 1) /* Unsigned/signed long */
 #define PLUS      (1 << 2) /* Show plus */
@@ -658,6 +663,7 @@ ee_vsprintf(char *buf, const char *fmt, va_list args)
     *str = '\0';
     return str - buf;
 }
+#endif
 
 void
 uart_send_char(char c)
@@ -673,15 +679,32 @@ ee_printf(const char *fmt, ...)
     int     n = 0;
 
     va_start(args, fmt);
+#if CORE_LOG && HAS_STDIO
+    /* the C library formats what ee_vsprintf cannot, such as %llu */
+    n = vsnprintf(buf, sizeof(buf), fmt, args);
+    if (n > (int)sizeof(buf) - 1)
+        n = sizeof(buf) - 1;
+#else
     ee_vsprintf(buf, fmt, args);
+#endif
     va_end(args);
     p = buf;
+#if CORE_LOG
+    /* one record, so the lines of two cores never interleave */
+#if !HAS_STDIO
+    while (p[n])
+        n++;
+#endif
+    if (n > 0)
+        core_log_write(p, n);
+#else
     while (*p)
     {
         uart_send_char(*p);
         n++;
         p++;
     }
+#endif
 
     return n;
 }
@@ -0,0 +1,11 @@
+# Regenerate the default reference table into OUT from CONFIGS, separated by
+# |, with the GOLDEN tool, and fail when it differs from CHECKED_IN
+string(REPLACE "|" ";" configs "${CONFIGS}")
+execute_process(COMMAND ${GOLDEN} -o ${OUT} ${configs} RESULT_VARIABLE rc)
+if(rc)
+    message(FATAL_ERROR "coremark_golden failed: ${rc}")
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${OUT} ${CHECKED_IN} RESULT_VARIABLE rc)
+if(rc)
+    message(FATAL_ERROR "${CHECKED_IN} is out of date, rebuild it with the golden_default target")
+endif()
@@ -0,0 +1,28 @@
+# Run the host build on a pty through DECODE, as a board on a serial port,
+# with telemetry on, and check that the result frame and the text, sharing
+# the console ring, both come through whole. RESULTS reads the record back
+# out of the text.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+execute_process(COMMAND ${DECODE} -o ${WORK}/run -x ${WORK}/console.log
+                        -e "${COREMARK} 0x0 0x0 0x66 300 -b -c2 -s"
+                RESULT_VARIABLE rc
+                ERROR_VARIABLE summary)
+if(rc)
+    message(FATAL_ERROR "telemetry_decode failed: ${rc}\n${summary}")
+endif()
+if(NOT summary MATCHES "frames [1-9][0-9]*, bad 0, unknown 0, .* lost 0, late 0, duplicate 0, restarts 0")
+    message(FATAL_ERROR "frames were damaged or lost: ${summary}")
+endif()
+file(STRINGS ${WORK}/run_result.csv rows)
+if(NOT rows MATCHES ";0,[0-9.]+,2,300,0$")
+    message(FATAL_ERROR "no result frame of 2 contexts, 300 iterations and no errors: ${rows}")
+endif()
+file(READ ${WORK}/console.log text)
+if(NOT text MATCHES "Correct operation validated")
+    message(FATAL_ERROR "the text of the run did not come through:\n${text}")
+endif()
+execute_process(COMMAND ${RESULTS} ${WORK}/console.log OUTPUT_VARIABLE csv RESULT_VARIABLE rc)
+if(rc OR NOT csv MATCHES "\n0,[0-9.]+,[^\n]*,300,2,666,1,0,")
+    message(FATAL_ERROR "no valid run record in the text:\n${csv}")
+endif()
@@ -0,0 +1,53 @@
+/**
+ * @file      test_check.h
+ *
+ * @brief Checks shared by the host tests
+ */
+
+/* Topic : Description
+        Each test in this directory is a host program run by CTest. CHECK
+   prints the failed condition and its line, and the test returns the number
+   of failures from <test_failures>, so a non zero exit fails it.
+*/
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <stdio.h>
+
+static int test_failed;
+
+#define CHECK(cond)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(cond))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, \
+                    #cond);                                                \
+            test_failed++;                                                 \
+        }                                                                  \
+    } while (0)
+
+#define CHECK_U64(got, want)                                               \
+    do                                                                     \
+    {                                                                      \
+        unsigned long long check_got = (got), check_want = (want);        \
+        if (check_got != check_want)                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: %s is 0x%llx, expected 0x%llx\n",      \
+                    __FILE__, __LINE__, #got, check_got, check_want);      \
+            test_failed++;                                                 \
+        }                                                                  \
+    } while (0)
+
+static int
+test_failures(const char *name)
+{
+    if (test_failed)
+        fprintf(stderr, "%s: %d check%s failed\n", name, test_failed,
+                test_failed == 1 ? "" : "s");
+    else
+        printf("%s: passed\n", name);
+    return test_failed != 0;
+}
+
+#endif /* TEST_CHECK_H */
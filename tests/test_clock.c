@@ -0,0 +1,120 @@
+/**
+ * @file      test_clock.c
+ *
+ * @brief Host test of <core_clock_add> on synthetic counter traces
+ */
+
+#include "coremark.h"
+#include "core_clock.h"
+#include "test_check.h"
+
+static ee_u32 port_ref, port_cycles;
+
+/* The port reads the next pair of the trace */
+void
+portable_clock_sample(void)
+{
+    core_clock_sample(port_ref, port_cycles);
+}
+
+/* Function : steady
+        Add <pairs> pairs to <c>, <ref_step> reference ticks and <cycle_step>
+   cycles apart, from raw <ref> and <cycles>, wrapping as the 32 bit
+   counters do.
+*/
+static void
+steady(core_clock *c, ee_u32 *ref, ee_u32 *cycles, ee_u32 ref_step, ee_u32 cycle_step, int pairs)
+{
+    int i;
+
+    for (i = 0; i < pairs; i++)
+    {
+        core_clock_add(c, *ref, *cycles);
+        *ref += ref_step;
+        *cycles += cycle_step;
+    }
+}
+
+int
+main(void)
+{
+    core_clock c;
+    ee_u32     ref, cycles;
+
+    /* 873MHz read every 500ms for 20s: the cycle counter wraps 4 times and
+     * the reference once */
+    core_clock_reset(&c);
+    ref    = 0xfff00000u;
+    cycles = 0xf0000000u;
+    steady(&c, &ref, &cycles, 500000, 436500000, 41);
+    CHECK(c.intervals == 40);
+    CHECK(core_clock_khz(&c) == 873000);
+    CHECK(c.min_khz == 873000 && c.max_khz == 873000 && c.last_khz == 873000);
+    CHECK_U64(c.ref_last - c.ref_first, 20000000);
+    CHECK_U64(c.cycles_last - c.cycles_first, 17460000000ull);
+
+    /* both counters wrapping between the same two reads */
+    core_clock_reset(&c);
+    core_clock_add(&c, 0xffffff00u, 0xffffff00u);
+    core_clock_add(&c, 0x00002000u, 0x00c00000u);
+    CHECK(c.intervals == 1);
+    CHECK(core_clock_khz(&c) == (ee_u32)((0x100c00000ull - 0xffffff00ull) * 1000 / (0x100002000ull - 0xffffff00ull)));
+
+    /* 4.9s between reads at 873MHz, just short of a wrap of the cycles */
+    core_clock_reset(&c);
+    ref    = 0xffffffffu;
+    cycles = 0xffffffffu;
+    steady(&c, &ref, &cycles, 4900000, 4277700000u, 4);
+    CHECK(c.intervals == 3);
+    CHECK(core_clock_khz(&c) == 873000);
+
+    /* pairs closer than CLOCK_MIN_REF_TICKS are merged into the next */
+    core_clock_reset(&c);
+    ref    = 0xfffffc00u;
+    cycles = 0xfffe0000u;
+    steady(&c, &ref, &cycles, CLOCK_MIN_REF_TICKS / 4, CLOCK_MIN_REF_TICKS / 4 * 150, 17);
+    CHECK(c.pairs == 17);
+    CHECK(c.intervals == 4);
+    CHECK(core_clock_khz(&c) == 150000);
+
+    /* 150MHz then 300MHz across the wraps: the run averages, the intervals
+     * show the step */
+    core_clock_reset(&c);
+    ref    = 0xfffe0000u;
+    cycles = 0xc0000000u;
+    steady(&c, &ref, &cycles, 500000, 75000000, 10);
+    steady(&c, &ref, &cycles, 500000, 150000000, 11);
+    CHECK(c.intervals == 20);
+    CHECK(c.min_khz == 150000);
+    CHECK(c.max_khz == 300000);
+    CHECK(c.last_khz == 300000);
+    CHECK(core_clock_khz(&c) == (10 * 75000000ull + 10 * 150000000ull) * 1000 / (20 * 500000ull));
+
+    /* a ROSC at 11.7654MHz comes out to the kHz below */
+    core_clock_reset(&c);
+    ref    = 0xffff8000u;
+    cycles = 0xffffff00u;
+    steady(&c, &ref, &cycles, 500000, 5882700, 30);
+    CHECK(core_clock_khz(&c) == 11765);
+    CHECK(c.min_khz == 11765 && c.max_khz == 11765);
+
+    /* one pair, or none, is not a measurement */
+    core_clock_reset(&c);
+    CHECK(core_clock_khz(&c) == 0);
+    core_clock_add(&c, 0xffffffffu, 0xffffffffu);
+    CHECK(core_clock_khz(&c) == 0 && c.intervals == 0);
+
+    /* the run only takes pairs between start and stop */
+    port_ref    = 0xfffffff0u;
+    port_cycles = 0xfffffff0u;
+    core_clock_sample(1, 1);
+    core_clock_start();
+    port_ref += 1000000;
+    port_cycles += 200000000;
+    core_clock_stop();
+    core_clock_sample(port_ref + 1000000, port_cycles + 500000000);
+    CHECK(core_clock_run.pairs == 2);
+    CHECK(core_clock_khz(&core_clock_run) == 200000);
+
+    return test_failures("clock");
+}
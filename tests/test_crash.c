@@ -0,0 +1,77 @@
+/**
+ * @file      test_crash.c
+ *
+ * @brief Host test of <core_crash_encode> and <core_crash_decode>
+ */
+
+#include "coremark.h"
+#include "core_crash.h"
+#include "test_check.h"
+#include <string.h>
+
+static void
+check_same(const core_crash *a, const core_crash *b)
+{
+    int i;
+
+    CHECK(a->cause == b->cause);
+    CHECK(a->core == b->core);
+    CHECK_U64(a->pc, b->pc);
+    CHECK_U64(a->lr, b->lr);
+    CHECK_U64(a->cfsr, b->cfsr);
+    CHECK_U64(a->hfsr, b->hfsr);
+    for (i = 0; i < CRASH_CONTEXTS; i++)
+        CHECK_U64(a->iteration[i], b->iteration[i]);
+    CHECK(a->mhz == b->mhz);
+    CHECK(a->vsel == b->vsel);
+    CHECK(a->temp10 == b->temp10);
+}
+
+int
+main(void)
+{
+    core_crash fault = { CRASH_FAULT, 1, 0x10001234, 0xfffffff9, 0x00008200,
+                         0x40000000, { 1234, CRASH_IDLE }, 420, 11, 523 };
+    core_crash hang  = { CRASH_HANG, 0, 0, 0, 0, 0, { 0, 99999 }, 0, 0, -105 };
+    core_crash out, untouched;
+    ee_u32     words[CRASH_WORDS], bad[CRASH_WORDS];
+    int        w, b;
+
+    /* round trip, with a negative temperature and an idle context */
+    core_crash_encode(&fault, words);
+    memset(&out, 0, sizeof(out));
+    CHECK(core_crash_decode(&out, words));
+    check_same(&out, &fault);
+
+    core_crash_encode(&hang, words);
+    CHECK(core_crash_decode(&out, words));
+    check_same(&out, &hang);
+
+    /* the live record starts out as no crash with idle contexts */
+    core_crash_encode(&core_crash_live, words);
+    CHECK(core_crash_decode(&out, words));
+    CHECK(out.cause == CRASH_NONE);
+    CHECK(out.iteration[0] == CRASH_IDLE && out.iteration[1] == CRASH_IDLE);
+
+    /* any single bit flipped, in the record or its checksum, is rejected and
+     * leaves the output alone */
+    core_crash_encode(&fault, words);
+    memset(&untouched, 0x5a, sizeof(untouched));
+    for (w = 0; w < CRASH_WORDS; w++)
+        for (b = 0; b < 32; b++)
+        {
+            memcpy(bad, words, sizeof(bad));
+            bad[w] ^= 1u << b;
+            memcpy(&out, &untouched, sizeof(out));
+            CHECK(!core_crash_decode(&out, bad));
+            CHECK(memcmp(&out, &untouched, sizeof(out)) == 0);
+        }
+
+    /* memory that was never written is not a record */
+    memset(bad, 0, sizeof(bad));
+    CHECK(!core_crash_decode(&out, bad));
+    memset(bad, 0xff, sizeof(bad));
+    CHECK(!core_crash_decode(&out, bad));
+
+    return test_failures("crash");
+}
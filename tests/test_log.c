@@ -0,0 +1,193 @@
+/**
+ * @file      test_log.c
+ *
+ * @brief Host test of the console ring of <core_log.h>
+ */
+
+/* Topic : Description
+        Built with a ring of LOG_RING_BYTES = 256, so it wraps every few
+   records and fills up as soon as the consumer falls behind. Checks that
+   text comes out whole across the wrap, that a full ring drops exactly the
+   records it refused and counts their bytes, and that records of several
+   threads writing at once come out whole and, per thread, in order.
+*/
+#include "coremark.h"
+#include "core_log.h"
+#include "test_check.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PRODUCERS 4
+#define RECORDS   20000 /* Per producer */
+
+static atomic_uint kicks;
+
+void
+portable_log_kick(void)
+{
+    atomic_fetch_add(&kicks, 1);
+}
+
+/* Function : drain
+        Take everything ready out of the ring, appending it to <out> at
+   <*len>.
+
+        Returns:
+        The bytes taken.
+*/
+static ee_u32
+drain(char *out, size_t *len, size_t size)
+{
+    const char *piece;
+    ee_u32      n, taken = 0;
+
+    while ((n = core_log_next(&piece)) != 0)
+    {
+        if (*len + n <= size)
+            memcpy(out + *len, piece, n);
+        *len += n;
+        taken += n;
+        core_log_done(n);
+    }
+    return taken;
+}
+
+typedef struct PRODUCER_S
+{
+    pthread_t thread;
+    int       id;
+    ee_u32    written, dropped; /* Records, by what core_log_write said */
+    ee_u32    dropped_bytes;
+} producer;
+
+static atomic_int producers_done;
+
+static void *
+produce(void *arg)
+{
+    producer *p = (producer *)arg;
+    char      text[32];
+    int       i, n;
+
+    for (i = 0; i < RECORDS; i++)
+    {
+        /* lengths from 8 to 18 bytes, so records straddle the wrap */
+        n = snprintf(text, sizeof(text), "%d:%d%.*s\n", p->id, i, i % 7, "#######");
+        if (core_log_write(text, (ee_u32)n) == (ee_u32)n)
+            p->written++;
+        else
+        {
+            p->dropped++;
+            p->dropped_bytes += n;
+        }
+    }
+    atomic_fetch_add(&producers_done, 1);
+    return NULL;
+}
+
+int
+main(void)
+{
+    static char out[PRODUCERS * RECORDS * 24], expect[500 * 64];
+    static producer producers[PRODUCERS];
+    ee_u32          dropped = 0, received[PRODUCERS], last[PRODUCERS];
+    size_t          len = 0, elen = 0;
+    char           *line, *end;
+    int             i, id, seq, bad = 0;
+
+    /* one writer and the consumer in turn, across many wraps */
+    for (i = 0; i < 500; i++)
+    {
+        char text[64];
+        int  n = snprintf(text, sizeof(text), "record %d %.*s\n", i, i % 41, "abcdefghijklmnopqrstuvwxyz0123456789ABCDE");
+
+        CHECK(core_log_write(text, (ee_u32)n) == (ee_u32)n);
+        memcpy(expect + elen, text, n);
+        elen += n;
+        if (i % 3 == 2)
+            drain(out, &len, sizeof(out));
+    }
+    drain(out, &len, sizeof(out));
+    CHECK(len == elen && memcmp(out, expect, elen) == 0);
+    CHECK(core_log_pending() == 0);
+    CHECK(core_log_dropped() == 0);
+    CHECK(atomic_load(&kicks) == 500);
+
+    /* nothing drains: 10 bytes take a 4 byte header and 12 of the ring, so
+     * 16 records fit and every one after is dropped and counted */
+    for (i = 0; i < 20; i++)
+        CHECK(core_log_write("0123456789", 10) == (i < LOG_RING_BYTES / 16 ? 10 : 0));
+    dropped += (20 - LOG_RING_BYTES / 16) * 10;
+    CHECK(core_log_dropped() == dropped);
+    CHECK(core_log_pending() == LOG_RING_BYTES);
+    /* a record larger than the whole ring never fits */
+    CHECK(core_log_write(expect, LOG_RING_BYTES) == 0);
+    dropped += LOG_RING_BYTES;
+    len = 0;
+    CHECK(drain(out, &len, sizeof(out)) == LOG_RING_BYTES / 16 * 10);
+    CHECK(core_log_pending() == 0);
+    CHECK(core_log_dropped() == dropped);
+    /* room again once drained */
+    CHECK(core_log_write("after\n", 6) == 6);
+    len = 0;
+    drain(out, &len, sizeof(out));
+    CHECK(len == 6 && memcmp(out, "after\n", 6) == 0);
+
+    /* several producers at once against one consumer */
+    len = 0;
+    for (i = 0; i < PRODUCERS; i++)
+    {
+        producers[i].id = i;
+        CHECK(pthread_create(&producers[i].thread, NULL, produce, &producers[i]) == 0);
+    }
+    while (atomic_load(&producers_done) < PRODUCERS || core_log_pending())
+        drain(out, &len, sizeof(out));
+    for (i = 0; i < PRODUCERS; i++)
+        pthread_join(producers[i].thread, NULL);
+    CHECK(len < sizeof(out));
+    out[len] = '\0';
+
+    memset(received, 0, sizeof(received));
+    memset(last, 0xff, sizeof(last));
+    for (line = out; *line; line = end + 1)
+    {
+        char tail[16];
+
+        end = strchr(line, '\n');
+        if (end == NULL)
+        {
+            bad++;
+            break;
+        }
+        *end    = '\0';
+        tail[0] = '\0';
+        if (sscanf(line, "%d:%d%15s", &id, &seq, tail) < 2 || id < 0 || id >= PRODUCERS
+            || strspn(tail, "#") != strlen(tail) || (int)strlen(tail) != seq % 7)
+        {
+            bad++;
+            continue;
+        }
+        /* in order per producer, none twice */
+        if (last[id] != 0xffffffffu && (ee_u32)seq <= last[id])
+            bad++;
+        last[id] = seq;
+        received[id]++;
+    }
+    CHECK(bad == 0);
+    for (i = 0; i < PRODUCERS; i++)
+    {
+        CHECK(received[i] == producers[i].written);
+        CHECK(producers[i].written + producers[i].dropped == RECORDS);
+        dropped += producers[i].dropped_bytes;
+    }
+    CHECK(core_log_dropped() == dropped);
+    CHECK(core_log_pending() == 0);
+    printf("log: %lu bytes dropped by %d producers into %d bytes\n",
+           (unsigned long)core_log_dropped(),
+           PRODUCERS,
+           LOG_RING_BYTES);
+
+    return test_failures("log");
+}
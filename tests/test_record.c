@@ -0,0 +1,195 @@
+/**
+ * @file      test_record.c
+ *
+ * @brief Host test of <core_record_print> read back by <coremark_result_parse>
+ */
+
+#include "coremark.h"
+#include "core_record.h"
+#include "coremark_results.h"
+#include "test_check.h"
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+
+void
+portable_clock_info(ee_u32 *requested_khz, ee_u32 *measured_khz, ee_s32 *vsel)
+{
+    *requested_khz = 300000;
+    *measured_khz  = 299000;
+    *vsel          = 11;
+}
+
+/* Function : capture
+        Print the record of <r> and <num_contexts> contexts of <results>
+   into <out>, one line with its newline.
+*/
+static void
+capture(const core_record *r, core_results *results, ee_u32 num_contexts, char *out, size_t size)
+{
+    FILE  *f = tmpfile();
+    int    saved;
+    size_t n;
+
+    fflush(stdout);
+    saved = dup(1);
+    dup2(fileno(f), 1);
+    core_record_print(r, results, num_contexts);
+    fflush(stdout);
+    dup2(saved, 1);
+    close(saved);
+    rewind(f);
+    n = fread(out, 1, size - 1, f);
+    out[n] = '\0';
+    fclose(f);
+}
+
+/* Function : parse_stream
+        Feed every line of <stream> to the parser, keeping the last record in
+   <r>.
+
+        Returns:
+        The number of lines taken as records.
+*/
+static int
+parse_stream(const char *stream, coremark_result *r)
+{
+    char            line[4096];
+    const char     *end;
+    coremark_result one;
+    int             records = 0;
+    size_t          n;
+
+    while (*stream)
+    {
+        end = strchr(stream, '\n');
+        n   = end ? (size_t)(end - stream) : strlen(stream);
+        memcpy(line, stream, n);
+        line[n] = '\0';
+        if (coremark_result_parse(line, &one))
+        {
+            *r = one;
+            records++;
+        }
+        stream += end ? n + 1 : n;
+    }
+    return records;
+}
+
+/* Function : cut
+        Copy <in> to <out> without the first <key> and what follows it up to
+   and with the next comma, as if the piece holding it was lost.
+*/
+static void
+cut(const char *in, const char *key, char *out)
+{
+    const char *at = strstr(in, key), *comma = strchr(at, ',');
+
+    memcpy(out, in, at - in);
+    strcpy(out + (at - in), comma + 1);
+}
+
+int
+main(void)
+{
+    static char     line[4096], broken[4096], stream[16384];
+    static core_results results[2];
+    core_record     rec = { 3, 12345678, 1234.5678, 0, 41.5f, 43.0f, 0, 0, 0 };
+    coremark_result r;
+    int             i;
+
+    for (i = 0; i < 2; i++)
+    {
+        results[i].iterations  = 4000;
+        results[i].size        = 666;
+        results[i].crclist     = 0xe714;
+        results[i].crcmatrix   = 0x1fd7;
+        results[i].crcstate    = 0x8e3a;
+        results[i].crc         = 0x65c5;
+        results[i].start_ticks = 100;
+        results[i].stop_ticks  = 100 + 12000000 + i;
+    }
+    capture(&rec, results, 2, line, sizeof(line));
+    CHECK(strncmp(line, "{\"record\":\"coremark\"", 20) == 0);
+    CHECK(strstr(line, ",\"check\":\"0x") != NULL);
+    CHECK(line[strlen(line) - 1] == '\n');
+
+    /* the record alone, read back field by field */
+    CHECK(parse_stream(line, &r) == 1);
+    CHECK(r.run == 3);
+    CHECK(fabs(r.score - 1234.5678) < 0.001);
+    CHECK(r.ticks == 12345678);
+    CHECK(r.iterations == 4000);
+    CHECK(r.contexts == 2);
+    CHECK(r.size == 666);
+    CHECK(r.valid == 1);
+    CHECK(r.errors == 0);
+    CHECK(fabs(r.requested_mhz - 300) < 0.001);
+    CHECK(fabs(r.measured_mhz - 299) < 0.001);
+    CHECK(r.vsel == 11);
+    CHECK(fabs(r.temp_start_c - 41.5) < 0.01);
+    CHECK(fabs(r.temp_peak_c - 43.0) < 0.01);
+    CHECK(strcmp(r.compiler, COMPILER_VERSION) == 0);
+    CHECK(r.num_cores == 2);
+    CHECK(r.cores[1].core == 1);
+    CHECK(r.cores[1].crclist == 0xe714);
+    CHECK(r.cores[1].crcfinal == 0x65c5);
+    CHECK(r.cores[1].ticks == 12000001);
+
+    /* among console text, between and around other records */
+    snprintf(stream, sizeof(stream), "CoreMark Size    : 666\nTotal ticks      : 12345678\n%s%s\nshmoo,x,1,2,pass,3,\n%s",
+             line, line, line);
+    CHECK(parse_stream(stream, &r) == 3);
+
+    /* a lost piece leaves valid JSON, but not a record */
+    cut(line, "\"flags\":", broken);
+    CHECK(coremark_result_parse(broken, &r) == 0);
+    cut(line, "\"temp_start_c\":", broken);
+    CHECK(coremark_result_parse(broken, &r) == 0);
+    cut(line, "\"requested_mhz\":", broken);
+    CHECK(coremark_result_parse(broken, &r) == 0);
+
+    /* a changed byte anywhere before the check */
+    for (i = 0; line + i < strstr(line, ",\"check\""); i++)
+    {
+        strcpy(broken, line);
+        broken[i] ^= 0x04;
+        if (coremark_result_parse(broken, &r))
+        {
+            fprintf(stderr, "byte %d changed still parses\n", i);
+            CHECK(0);
+            break;
+        }
+    }
+
+    /* cut short */
+    for (i = 1; i < (int)strlen(line) - 2; i += 7)
+    {
+        memcpy(broken, line, i);
+        broken[i] = '\0';
+        CHECK(coremark_result_parse(broken, &r) == 0);
+    }
+
+    /* a lost line in the stream costs that record only */
+    cut(line, "\"mem\":", broken);
+    snprintf(stream, sizeof(stream), "%s%s%s", line, broken, line);
+    CHECK(parse_stream(stream, &r) == 2);
+
+    /* without a sensor, and without a baseline */
+    rec.temp_start = rec.temp_end = NAN;
+    rec.errors = -1;
+    capture(&rec, results, 1, line, sizeof(line));
+    CHECK(strstr(line, "\"temp_start_c\":null") != NULL);
+    CHECK(strstr(line, "\"temp_peak_c\":null") != NULL);
+    CHECK(parse_stream(line, &r) == 1);
+    CHECK(isnan(r.temp_start_c) && isnan(r.temp_end_c) && isnan(r.temp_peak_c));
+    CHECK(r.baseline_coremark_mhz == 0);
+    CHECK(r.valid == 0 && r.errors == -1);
+    CHECK(r.num_cores == 1);
+
+    /* from a build before the check */
+    CHECK(coremark_result_parse("{\"record\":\"coremark\",\"run\":7,\"score\":10.5,\"cores\":[]}", &r) == 1);
+    CHECK(r.run == 7);
+
+    return test_failures("record");
+}
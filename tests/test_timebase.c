@@ -0,0 +1,59 @@
+/**
+ * @file      test_timebase.c
+ *
+ * @brief Host test of <core_timebase_extend> across counter wraps
+ */
+
+#include "core_timebase.h"
+#include "test_check.h"
+
+/* Feed <n> raw reads to a fresh timebase and check each extended value */
+static void
+extend_sequence(const ee_u32 *raw, const ee_u64 *want, int n)
+{
+    core_timebase tb = CORE_TIMEBASE_INIT;
+    int           i;
+
+    for (i = 0; i < n; i++)
+        CHECK_U64(core_timebase_extend(&tb, raw[i]), want[i]);
+}
+
+int
+main(void)
+{
+    /* across 0xffffffff, as the host counter and the PIO counter do */
+    static const ee_u32 raw_wrap[]  = { 0xfffffff0u, 0xffffffffu, 0, 5, 5, 0x10 };
+    static const ee_u64 want_wrap[] = { 0xfffffff0ull, 0xffffffffull,
+                                        0x100000000ull, 0x100000005ull,
+                                        0x100000005ull, 0x100000010ull };
+    /* landing exactly on the last value before the wrap and on 0 */
+    static const ee_u32 raw_edge[]  = { 0, 0xffffffffu, 0, 0xffffffffu, 0 };
+    static const ee_u64 want_edge[] = { 0, 0xffffffffull, 0x100000000ull,
+                                        0x1ffffffffull, 0x200000000ull };
+    core_timebase tb = CORE_TIMEBASE_INIT;
+    ee_u64        expect;
+    ee_u32        raw;
+    int           i;
+
+    extend_sequence(raw_wrap, want_wrap, 6);
+    extend_sequence(raw_edge, want_edge, 5);
+
+    /* many wraps, read four times per wrap as the periodic IRQ does */
+    raw    = 0xc0000000u;
+    expect = raw;
+    for (i = 0; i < 4 * 1000; i++)
+    {
+        CHECK_U64(core_timebase_extend(&tb, raw), expect);
+        raw += 0x3fffffffu;
+        expect += 0x3fffffffu;
+    }
+    CHECK(tb.wraps == (ee_u32)((expect - 0x3fffffffu) >> 32));
+
+    /* a counter that does not move is not a wrap */
+    tb.last  = 0;
+    tb.wraps = 7;
+    for (i = 0; i < 3; i++)
+        CHECK_U64(core_timebase_extend(&tb, 0x1234), (7ull << 32) | 0x1234);
+
+    return test_failures("timebase");
+}
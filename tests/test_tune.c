@@ -0,0 +1,205 @@
+/**
+ * @file      test_tune.c
+ *
+ * @brief Host test of <core_tune_search> against a simulated device
+ */
+
+/* Topic : Description
+        The device fails validation above <sim_limit> MHz at its first level,
+   SIM_LEVEL_MHZ higher at each level after, and hangs SIM_HANG_MHZ past
+   that. A hang "reboots" by a longjmp back to <run_search>, which loads the
+   saved state and resumes the search, as the watchdog does on the RP2. The
+   runs themselves are real CoreMark iterations checked by
+   <core_tune_check>, built with a small TUNE_ITERATIONS.
+*/
+#include "coremark.h"
+#include "core_tune.h"
+#include "test_check.h"
+#include <setjmp.h>
+#include <string.h>
+
+#define SIM_LEVEL_MHZ 50
+#define SIM_HANG_MHZ  60
+
+static const core_tune_level levels[] = {
+    { 0, 1100 }, { 1, 1200 }, { 2, 1300 }
+};
+#define NUM_LEVELS (sizeof(levels) / sizeof(levels[0]))
+
+static ee_u32  sim_limit, sim_vsel, sim_clock;
+static ee_u32  sim_scratch[TUNE_WORDS];
+static jmp_buf sim_reboot;
+static ee_u32  sim_reboots;
+static ee_u32  sim_hang_at;     /* Clock of the first trial to hang, 0 for none */
+static ee_u32  sim_first_hang;  /* Clock of the first trial that hung */
+static ee_u32  sim_trials;      /* Clocks set, to catch a search that never ends */
+static jmp_buf sim_stuck;
+
+#define SIM_MAX_TRIALS 1000
+
+ee_u32
+portable_tune_set(ee_u32 vsel, ee_u32 mhz)
+{
+    sim_vsel  = vsel;
+    sim_clock = mhz;
+    if (++sim_trials > SIM_MAX_TRIALS)
+        longjmp(sim_stuck, 1);
+    return 1;
+}
+
+ee_u32
+portable_tune_run(ee_u32 iterations)
+{
+    ee_u32 limit = sim_limit + sim_vsel * SIM_LEVEL_MHZ, kind;
+
+    if (sim_clock > limit + SIM_HANG_MHZ || sim_clock == sim_hang_at)
+    {
+        if (sim_reboots == 0)
+            sim_first_hang = sim_clock;
+        sim_hang_at = 0;
+        longjmp(sim_reboot, 1);
+    }
+    kind = core_tune_check(iterations);
+    return sim_clock > limit ? ID_MATRIX : kind;
+}
+
+void
+portable_tune_save(const ee_u32 *words)
+{
+    memcpy(sim_scratch, words, sizeof(sim_scratch));
+}
+
+ee_u32
+portable_tune_load(ee_u32 *words)
+{
+    memcpy(words, sim_scratch, sizeof(sim_scratch));
+    return (words[0] >> 24) == TUNE_MAGIC;
+}
+
+/* Function : run_search
+        Run a whole search on a device failing above <limit>, through every
+   simulated reboot, leaving the result in <t>.
+*/
+static void
+run_search(core_tune *t, ee_u32 limit, ee_u32 hang_at)
+{
+    ee_u32 words[TUNE_WORDS];
+
+    sim_limit   = limit;
+    sim_hang_at = hang_at;
+    sim_reboots = 0;
+    sim_trials  = 0;
+    core_tune_start(t);
+    core_tune_pack(t, words);
+    portable_tune_save(words);
+    if (setjmp(sim_stuck))
+    {
+        fprintf(stderr, "search did not end after %d clocks\n", SIM_MAX_TRIALS);
+        CHECK(0);
+        return;
+    }
+    if (setjmp(sim_reboot))
+        sim_reboots++;
+    CHECK(portable_tune_load(words));
+    CHECK(core_tune_unpack(t, words));
+    core_tune_search(t, levels, NUM_LEVELS);
+}
+
+/* Function : expected_best
+        Highest clock on the search grid from <floor> that is at most
+   <limit>.
+*/
+static ee_u32
+expected_best(ee_u32 floor, ee_u32 limit)
+{
+    if (limit > TUNE_MAX_MHZ)
+        limit = TUNE_MAX_MHZ;
+    return floor + (limit - floor) / TUNE_STEP_MHZ * TUNE_STEP_MHZ;
+}
+
+int
+main(void)
+{
+    static core_tune t, back;
+    ee_u32           words[TUNE_WORDS], floor, i;
+
+    /* the state survives the scratch registers */
+    core_tune_start(&t);
+    t.level     = 2;
+    t.lo        = 396;
+    t.hi        = 726;
+    t.trying    = 558;
+    t.best[0]   = 396;
+    t.best[1]   = 444;
+    t.good_vsel = 1;
+    t.good_mhz  = 444;
+    core_tune_pack(&t, words);
+    CHECK(core_tune_unpack(&back, words));
+    CHECK(memcmp(&t, &back, sizeof(t)) == 0);
+    words[0] ^= 1u << 24;
+    CHECK(!core_tune_unpack(&back, words));
+
+    /* best of each level against the simulated limit; the second level
+     * starts at 396 and its first trial, 558, hangs past 450 + 60 */
+    run_search(&t, 400, 0);
+    CHECK(t.level == NUM_LEVELS);
+    CHECK(sim_reboots > 0);
+    floor = TUNE_MIN_MHZ;
+    for (i = 0; i < NUM_LEVELS; i++)
+    {
+        CHECK_U64(t.best[i], expected_best(floor, sim_limit + i * SIM_LEVEL_MHZ));
+        floor = t.best[i];
+    }
+    CHECK(t.good_vsel == NUM_LEVELS - 1 && t.good_mhz == t.best[NUM_LEVELS - 1]);
+
+    /* a limit above the search range ends on the top of the grid */
+    run_search(&t, 800, 0);
+    CHECK(sim_reboots == 0);
+    CHECK_U64(t.best[0], expected_best(TUNE_MIN_MHZ, TUNE_MAX_MHZ));
+
+    /* a reboot during a trial at a clock that would have passed, the
+     * second of the first level, counts it as unstable, and the search goes
+     * on below it */
+    run_search(&t, 400, 294);
+    CHECK(sim_reboots >= 1);
+    CHECK(sim_first_hang == 294);
+    CHECK(t.level == NUM_LEVELS);
+    CHECK_U64(t.best[0], expected_best(TUNE_MIN_MHZ, 294 - 1));
+
+    /* a finished search saved in scratch is not searched again */
+    sim_hang_at = 0;
+    core_tune_pack(&t, words);
+    portable_tune_save(words);
+    sim_clock = 0;
+    core_tune_search(&t, levels, NUM_LEVELS);
+    CHECK(sim_clock == 0);
+
+
+    /* bounds off the grid, as saved by a build with another range or step:
+     * a gap between one and two steps used to leave mid on lo for ever */
+    sim_limit   = 800;
+    sim_hang_at = 0;
+    sim_trials  = 0;
+    core_tune_start(&t);
+    t.lo = TUNE_MIN_MHZ;
+    t.hi = TUNE_MIN_MHZ + TUNE_STEP_MHZ + TUNE_STEP_MHZ / 2;
+    if (setjmp(sim_stuck) == 0)
+        core_tune_search(&t, levels, 1);
+    else
+        CHECK(0);
+    CHECK(t.level == 1);
+    CHECK_U64(t.best[0], TUNE_MIN_MHZ + TUNE_STEP_MHZ);
+    sim_trials = 0;
+    core_tune_start(&t);
+    t.lo = TUNE_MIN_MHZ + 1;
+    t.hi = TUNE_MAX_MHZ - 20;
+    if (setjmp(sim_stuck) == 0)
+        core_tune_search(&t, levels, 1);
+    else
+        CHECK(0);
+    CHECK(t.level == 1);
+    CHECK(t.best[0] < TUNE_MAX_MHZ - 20 && t.best[0] >= TUNE_MAX_MHZ - 20 - TUNE_STEP_MHZ);
+    CHECK((t.best[0] - (TUNE_MIN_MHZ + 1)) % TUNE_STEP_MHZ == 0);
+
+    return test_failures("tune");
+}
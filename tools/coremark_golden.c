@@ -0,0 +1,184 @@
+/**
+ * @file      coremark_golden.c
+ *
+ * @brief Host tool computing reference CRCs for any seeds and size
+ */
+
+/* Topic : Description
+        Runs the reference kernels of src/ on the host and prints the CRCs a
+   correct run produces.
+
+        coremark_golden <seed1> <seed2> <seed3> <size> [iterations [execs]]
+                prints the CRCs of one configuration.
+        coremark_golden -o <file> <config>...
+                writes the golden_table of <core_golden.c>, with an entry for
+   each config given as seed1,seed2,seed3,size[,iterations[,execs]]. Configs
+   with iterations also get a per iteration trace.
+
+        Size is the memory block of one context before it is split between
+   the algorithms, 2000 for a standard run. Iterations of 0 leave the final
+   CRC out, execs of 0 runs all algorithms.
+*/
+#include "coremark.h"
+#include "core_golden.h"
+#include <string.h>
+
+/* Function : parse_config
+        Fill in the inputs of <g> from four to six numbers in C notation.
+
+        Returns:
+        0 on success, -1 when the seeds or size are missing.
+*/
+static int
+parse_config(core_golden *g, char *const *fields, int count)
+{
+    long v[6] = { 0, 0, 0, 0, 0, 0 };
+    int  i;
+
+    if (count < 4 || count > 6)
+        return -1;
+    for (i = 0; i < count; i++)
+        v[i] = strtol(fields[i], NULL, 0);
+    memset(g, 0, sizeof(*g));
+    g->seed1      = (ee_s16)v[0];
+    g->seed2      = (ee_s16)v[1];
+    g->seed3      = (ee_s16)v[2];
+    g->size       = (ee_u32)v[3];
+    g->iterations = (ee_u32)v[4];
+    g->execs      = v[5] ? (ee_u32)v[5] : ALL_ALGORITHMS_MASK;
+    return g->size ? 0 : -1;
+}
+
+/* Function : compute
+        Run the kernels for <g> on a block of its size, recording the trace
+   of each iteration into <trace> when it is not NULL.
+*/
+static int
+compute(core_golden *g, core_golden_iter *trace)
+{
+    void *memblock = malloc(g->size);
+
+    if (memblock == NULL)
+        return -1;
+    core_golden_compute(g, memblock, trace);
+    free(memblock);
+    return 0;
+}
+
+/* Function : write_table
+        Compute each config and write the traces and table to <out>.
+
+        Returns:
+        0 on success, or the 1 based index of the config that failed.
+*/
+static int
+write_table(FILE *out, char *configs[], int count)
+{
+    core_golden       g;
+    core_golden_iter *trace;
+    char *            fields[7], *s;
+    int               i, n;
+    ee_u32            k;
+
+    fprintf(out, "/* Generated by coremark_golden, do not edit, from\n");
+    for (i = 0; i < count; i++)
+        fprintf(out, " *   %s\n", configs[i]);
+    fprintf(out, " */\n");
+    for (i = 0; i < count; i++)
+    {
+        n = 0;
+        for (s = strtok(configs[i], ","); s && n < 7; s = strtok(NULL, ","))
+            fields[n++] = s;
+        if (parse_config(&g, fields, n) != 0)
+            return i + 1;
+        trace = NULL;
+        if (g.iterations)
+        {
+            trace = malloc(g.iterations * sizeof(*trace));
+            if (trace == NULL)
+                return i + 1;
+        }
+        if (compute(&g, trace) != 0)
+            return i + 1;
+        if (trace)
+        {
+            fprintf(out, "#if CORE_ITERATION_CHECK\n");
+            fprintf(out, "static const core_golden_iter golden_trace_%d[] = {\n", i);
+            for (k = 0; k < g.iterations; k++)
+                fprintf(out, "    { 0x%04x, 0x%04x, 0x%04x },\n",
+                        trace[k].crc, trace[k].crcmatrix, trace[k].crcstate);
+            fprintf(out, "};\n#define GOLDEN_TRACE_%d golden_trace_%d\n", i, i);
+            fprintf(out, "#else\n#define GOLDEN_TRACE_%d NULL\n#endif\n", i);
+            free(trace);
+        }
+        else
+            fprintf(out, "#define GOLDEN_TRACE_%d NULL\n", i);
+        fprintf(out,
+                "#define GOLDEN_ENTRY_%d { %d, %d, %d, 0x%x, %lu, %lu, 0x%04x, "
+                "0x%04x, 0x%04x, 0x%04x, GOLDEN_TRACE_%d }\n",
+                i, g.seed1, g.seed2, g.seed3, (unsigned)g.execs,
+                (unsigned long)g.size, (unsigned long)g.iterations, g.crclist,
+                g.crcmatrix, g.crcstate, g.crc, i);
+    }
+    fprintf(out, "static const core_golden golden_table[] = {\n");
+    for (i = 0; i < count; i++)
+        fprintf(out, "    GOLDEN_ENTRY_%d,\n", i);
+    fprintf(out, "    { 0 }\n};\n");
+    return 0;
+}
+
+static void
+usage(void)
+{
+    fprintf(stderr,
+            "usage: coremark_golden <seed1> <seed2> <seed3> <size> "
+            "[iterations [execs]]\n"
+            "       coremark_golden -o <file> "
+            "<seed1,seed2,seed3,size[,iterations[,execs]]>...\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+    core_golden g;
+    FILE *      out;
+    int         bad;
+
+    if (argc > 2 && strcmp(argv[1], "-o") == 0)
+    {
+        out = fopen(argv[2], "w");
+        if (out == NULL)
+        {
+            perror(argv[2]);
+            return 1;
+        }
+        bad = write_table(out, argv + 3, argc - 3);
+        if (fclose(out) != 0 || bad)
+        {
+            if (bad)
+                fprintf(stderr, "coremark_golden: bad config %d\n", bad);
+            remove(argv[2]);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (parse_config(&g, argv + 1, argc - 1) != 0)
+    {
+        usage();
+        return 1;
+    }
+    if (compute(&g, NULL) != 0)
+    {
+        fprintf(stderr, "coremark_golden: cannot allocate %lu bytes\n",
+                (unsigned long)g.size);
+        return 1;
+    }
+    printf("crclist   : 0x%04x\n", g.crclist);
+    printf("crcmatrix : 0x%04x\n", g.crcmatrix);
+    printf("crcstate  : 0x%04x\n", g.crcstate);
+    if (g.iterations)
+        printf("crcfinal  : 0x%04x (%lu iterations)\n", g.crc,
+               (unsigned long)g.iterations);
+    return 0;
+}
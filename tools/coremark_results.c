@@ -0,0 +1,406 @@
+/**
+ * @file      coremark_results.c
+ *
+ * @brief Host library reading the run records of a console log
+ */
+
+#include "coremark_results.h"
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RECORD_PREFIX "{\"record\":\"coremark\""
+#define RECORD_CHECK  ",\"check\":\""
+
+enum FIELD_TYPE
+{
+    F_ULONG,
+    F_ULLONG,
+    F_LONG,
+    F_DOUBLE,
+    F_BOOL,
+    F_STRING,
+    F_HEX /* "0x..." string */
+};
+
+typedef struct FIELD_S
+{
+    const char *key;
+    int         type;
+    size_t      offset;
+    size_t      size; /* Of a string */
+} field;
+
+#define RUN(k, t)  { #k, t, offsetof(coremark_result, k), sizeof(((coremark_result *)0)->k) }
+#define CORE(k, t) { #k, t, offsetof(coremark_core_result, k), 0 }
+
+static const field run_fields[] = {
+    RUN(run, F_ULONG),           RUN(score, F_DOUBLE),
+    RUN(coremark_mhz, F_DOUBLE), RUN(baseline_coremark_mhz, F_DOUBLE),
+    RUN(equivalent_mhz, F_DOUBLE), RUN(drift_pct, F_DOUBLE),
+    RUN(ticks, F_ULLONG),
+    RUN(iterations, F_ULONG),    RUN(contexts, F_ULONG),
+    RUN(size, F_ULONG),          RUN(valid, F_BOOL),
+    RUN(errors, F_LONG),         RUN(requested_mhz, F_DOUBLE),
+    RUN(measured_mhz, F_DOUBLE), RUN(vsel, F_LONG),
+    RUN(temp_start_c, F_DOUBLE), RUN(temp_end_c, F_DOUBLE),
+    RUN(temp_peak_c, F_DOUBLE),  RUN(compiler, F_STRING),
+    RUN(flags, F_STRING),        RUN(mem, F_STRING),
+    RUN(features, F_STRING),     { NULL, 0, 0, 0 },
+};
+
+static const field core_fields[] = {
+    CORE(core, F_ULONG),     CORE(crclist, F_HEX),  CORE(crcmatrix, F_HEX),
+    CORE(crcstate, F_HEX),   CORE(crcfinal, F_HEX), CORE(ticks, F_ULLONG),
+    CORE(errors, F_LONG),    { NULL, 0, 0, 0 },
+};
+
+static const char *
+skip_ws(const char *p)
+{
+    while (isspace((unsigned char)*p))
+        p++;
+    return p;
+}
+
+/* Function : parse_string
+        Read the string at <p> into <out>, which may be NULL to skip it.
+
+        Returns:
+        The end of the string, or NULL when it is not one.
+*/
+static const char *
+parse_string(const char *p, char *out, size_t size)
+{
+    size_t n = 0;
+    char   c;
+
+    if (*p++ != '"')
+        return NULL;
+    while (*p && *p != '"')
+    {
+        c = *p++;
+        if (c == '\\' && *p)
+        {
+            c = *p++;
+            if (c == 'n')
+                c = '\n';
+            else if (c == 't')
+                c = '\t';
+        }
+        if (out && n + 1 < size)
+            out[n++] = c;
+    }
+    if (*p != '"')
+        return NULL;
+    if (out)
+        out[n] = '\0';
+    return p + 1;
+}
+
+/* Function : skip_value
+        Returns:
+        The end of the value of any type at <p>, or NULL when it is broken.
+*/
+static const char *
+skip_value(const char *p)
+{
+    char close;
+
+    p = skip_ws(p);
+    if (*p == '"')
+        return parse_string(p, NULL, 0);
+    if (*p != '{' && *p != '[')
+    {
+        while (*p && !strchr(",}] \t\r\n", *p))
+            p++;
+        return p;
+    }
+    close = *p == '{' ? '}' : ']';
+    p     = skip_ws(p + 1);
+    if (*p == close)
+        return p + 1;
+    for (;;)
+    {
+        if (close == '}')
+        {
+            p = parse_string(skip_ws(p), NULL, 0);
+            if (p == NULL || *(p = skip_ws(p)) != ':')
+                return NULL;
+            p++;
+        }
+        p = skip_value(p);
+        if (p == NULL)
+            return NULL;
+        p = skip_ws(p);
+        if (*p == close)
+            return p + 1;
+        if (*p++ != ',')
+            return NULL;
+    }
+}
+
+/* Function : parse_field
+        Store the value at <p> in the field of <fields> named <key> within
+   <base>, or skip it when there is none.
+*/
+static const char *
+parse_field(const field *fields, void *base, const char *key, const char *p)
+{
+    char  buf[256], *end;
+    char *at;
+
+    p = skip_ws(p);
+    for (; fields->key; fields++)
+        if (strcmp(fields->key, key) == 0)
+            break;
+    if (fields->key == NULL || strncmp(p, "null", 4) == 0)
+        return skip_value(p);
+    at = (char *)base + fields->offset;
+    switch (fields->type)
+    {
+    case F_STRING:
+        return parse_string(p, at, fields->size);
+    case F_HEX:
+        p = parse_string(p, buf, sizeof(buf));
+        *(unsigned long *)at = strtoul(buf, NULL, 0);
+        return p;
+    case F_BOOL:
+        *(int *)at = strncmp(p, "true", 4) == 0;
+        return skip_value(p);
+    case F_DOUBLE:
+        *(double *)at = strtod(p, &end);
+        return end;
+    case F_LONG:
+        *(long *)at = strtol(p, &end, 10);
+        return end;
+    case F_ULLONG:
+        *(unsigned long long *)at = strtoull(p, &end, 10);
+        return end;
+    default:
+        *(unsigned long *)at = strtoul(p, &end, 10);
+        return end;
+    }
+}
+
+/* Function : parse_object
+        Parse the object at <p>, handing each member to <member>.
+
+        Returns:
+        The end of the object, or NULL when it is broken.
+*/
+static const char *
+parse_object(const char *p,
+             const char *(*member)(void *ctx, const char *key, const char *value),
+             void *ctx)
+{
+    char key[64];
+
+    p = skip_ws(p);
+    if (*p++ != '{')
+        return NULL;
+    p = skip_ws(p);
+    if (*p == '}')
+        return p + 1;
+    for (;;)
+    {
+        p = parse_string(skip_ws(p), key, sizeof(key));
+        if (p == NULL || *(p = skip_ws(p)) != ':')
+            return NULL;
+        p = member(ctx, key, p + 1);
+        if (p == NULL)
+            return NULL;
+        p = skip_ws(p);
+        if (*p == '}')
+            return p + 1;
+        if (*p++ != ',')
+            return NULL;
+    }
+}
+
+static const char *
+core_member(void *ctx, const char *key, const char *value)
+{
+    return parse_field(core_fields, ctx, key, value);
+}
+
+static const char *
+run_member(void *ctx, const char *key, const char *value)
+{
+    coremark_result *r = (coremark_result *)ctx;
+    const char      *p;
+
+    if (strcmp(key, "cores") != 0)
+        return parse_field(run_fields, r, key, value);
+    p = skip_ws(value);
+    if (*p != '[')
+        return skip_value(p);
+    p = skip_ws(p + 1);
+    if (*p == ']')
+        return p + 1;
+    for (;;)
+    {
+        if (r->num_cores < RESULTS_MAX_CORES)
+            p = parse_object(p, core_member, &r->cores[r->num_cores++]);
+        else
+            p = skip_value(p);
+        if (p == NULL)
+            return NULL;
+        p = skip_ws(p);
+        if (*p == ']')
+            return p + 1;
+        if (*p++ != ',')
+            return NULL;
+    }
+}
+
+/* Same CRC16 as <crcu8> in core_util.c */
+static unsigned
+crcu8(unsigned char data, unsigned crc)
+{
+    int i;
+
+    for (i = 0; i < 8; i++, data >>= 1)
+    {
+        if ((data ^ crc) & 1)
+            crc = ((crc ^ 0x4002) >> 1) | 0x8000;
+        else
+            crc >>= 1;
+    }
+    return crc;
+}
+
+/* Function : check_ok
+        Returns:
+        0 when the record at <line> carries a check that does not match the
+   text before it, as when a piece of it was lost, else 1.
+*/
+static int
+check_ok(const char *line)
+{
+    const char *check = strstr(line, RECORD_CHECK);
+    unsigned    crc   = 0;
+
+    /* from a build before the check */
+    if (check == NULL)
+        return 1;
+    while (line < check)
+        crc = crcu8((unsigned char)*line++, crc);
+    return strtoul(check + strlen(RECORD_CHECK), NULL, 16) == crc;
+}
+
+/* Function : coremark_result_parse
+        Returns:
+        1 when <line> is a whole record, filling <r>, else 0.
+*/
+int
+coremark_result_parse(const char *line, coremark_result *r)
+{
+    line = skip_ws(line);
+    if (strncmp(line, RECORD_PREFIX, strlen(RECORD_PREFIX)) != 0 || !check_ok(line))
+        return 0;
+    memset(r, 0, sizeof(*r));
+    r->vsel         = -1;
+    r->temp_start_c = r->temp_end_c = r->temp_peak_c = NAN;
+    return parse_object(line, run_member, r) != NULL;
+}
+
+static void
+csv_string(FILE *out, const char *s)
+{
+    fputc('"', out);
+    for (; *s; s++)
+    {
+        if (*s == '"')
+            fputc('"', out);
+        fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+/* Function : csv_temp
+        Write <t> and a comma, only the comma when the temperature is not
+   known.
+*/
+static void
+csv_temp(FILE *out, double t)
+{
+    if (t == t)
+        fprintf(out, "%.1f", t);
+    fputc(',', out);
+}
+
+/* Function : coremark_result_csv_header
+        Column names of <coremark_result_csv>.
+*/
+void
+coremark_result_csv_header(FILE *out, int per_core)
+{
+    if (per_core)
+        fprintf(out, "run,core,crclist,crcmatrix,crcstate,crcfinal,ticks,errors\n");
+    else
+        fprintf(out,
+                "run,score,coremark_mhz,baseline_coremark_mhz,equivalent_mhz,drift_pct,"
+                "ticks,iterations,contexts,size,valid,errors,"
+                "requested_mhz,measured_mhz,vsel,temp_start_c,temp_end_c,temp_peak_c,"
+                "compiler,flags,mem,features\n");
+}
+
+/* Function : coremark_result_csv
+        Write <r> as one row, or with <per_core> as one row per context.
+*/
+void
+coremark_result_csv(FILE *out, const coremark_result *r, int per_core)
+{
+    const coremark_core_result *c;
+    unsigned                    i;
+
+    if (per_core)
+    {
+        for (i = 0; i < r->num_cores; i++)
+        {
+            c = &r->cores[i];
+            fprintf(out,
+                    "%lu,%lu,0x%04lx,0x%04lx,0x%04lx,0x%04lx,%llu,%ld\n",
+                    r->run,
+                    c->core,
+                    c->crclist,
+                    c->crcmatrix,
+                    c->crcstate,
+                    c->crcfinal,
+                    c->ticks,
+                    c->errors);
+        }
+        return;
+    }
+    fprintf(out,
+            "%lu,%.3f,%.4f,%.4f,%.3f,%.2f,%llu,%lu,%lu,%lu,%d,%ld,%.3f,%.3f,%ld,",
+            r->run,
+            r->score,
+            r->coremark_mhz,
+            r->baseline_coremark_mhz,
+            r->equivalent_mhz,
+            r->drift_pct,
+            r->ticks,
+            r->iterations,
+            r->contexts,
+            r->size,
+            r->valid,
+            r->errors,
+            r->requested_mhz,
+            r->measured_mhz,
+            r->vsel);
+    csv_temp(out, r->temp_start_c);
+    csv_temp(out, r->temp_end_c);
+    csv_temp(out, r->temp_peak_c);
+    csv_string(out, r->compiler);
+    fputc(',', out);
+    csv_string(out, r->flags);
+    fputc(',', out);
+    csv_string(out, r->mem);
+    fputc(',', out);
+    csv_string(out, r->features);
+    fputc('\n', out);
+}
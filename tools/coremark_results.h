@@ -0,0 +1,66 @@
+/**
+ * @file      coremark_results.h
+ *
+ * @brief Host library reading the run records of a console log
+ */
+
+/* Topic : Description
+        <coremark_result_parse> turns one line of console output into a
+   <coremark_result> when it is a record printed by <core_record_print>, and
+   ignores every other line, so a whole log can be fed through it. Keys it
+   does not know are skipped, so records from newer builds still parse. A
+   record whose check does not match its text lost a piece on the way and
+   is ignored too.
+
+        <coremark_result_csv> writes a parsed record as CSV, either one row
+   per run or one row per context of the run, for dashboards to load.
+*/
+#ifndef COREMARK_RESULTS_H
+#define COREMARK_RESULTS_H
+
+#include <stdio.h>
+
+#define RESULTS_MAX_CORES 64
+
+typedef struct COREMARK_CORE_RESULT_S
+{
+    unsigned long      core;
+    unsigned long      crclist, crcmatrix, crcstate, crcfinal;
+    unsigned long long ticks;
+    long               errors;
+} coremark_core_result;
+
+typedef struct COREMARK_RESULT_S
+{
+    unsigned long        run;
+    double               score;
+    double               coremark_mhz;
+    double               baseline_coremark_mhz; /* 0 without a baseline */
+    double               equivalent_mhz;
+    double               drift_pct;
+    unsigned long long   ticks;
+    unsigned long        iterations;
+    unsigned long        contexts;
+    unsigned long        size;
+    int                  valid;
+    long                 errors;
+    double               requested_mhz;
+    double               measured_mhz;
+    long                 vsel;
+    double               temp_start_c; /* NaN without a sensor */
+    double               temp_end_c;
+    double               temp_peak_c;
+    char                 compiler[64];
+    char                 flags[64];
+    char                 mem[32];
+    char                 features[256];
+    unsigned             num_cores;
+    coremark_core_result cores[RESULTS_MAX_CORES];
+} coremark_result;
+
+/* Returns 1 when <line> is a record, filling <r>, else 0 */
+int  coremark_result_parse(const char *line, coremark_result *r);
+void coremark_result_csv_header(FILE *out, int per_core);
+void coremark_result_csv(FILE *out, const coremark_result *r, int per_core);
+
+#endif /* COREMARK_RESULTS_H */
@@ -0,0 +1,64 @@
+/**
+ * @file      results_table.c
+ *
+ * @brief Host tool turning the run records of a console log into CSV
+ */
+
+/* Topic : Description
+        Reads a console log, from a file or standard input, and writes the
+   run records in it as CSV through <coremark_results.h>, skipping every
+   other line.
+
+        results_table [-c] [log]
+
+        Without -c there is one row per run, with -c one row per context of
+   each run. Logs of several boards can be concatenated.
+*/
+#include "coremark_results.h"
+#include <stdlib.h>
+#include <string.h>
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: results_table [-c] [log]\n");
+    exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+    static char            line[65536];
+    static coremark_result r;
+    FILE                  *in       = stdin;
+    int                    per_core = 0, records = 0, i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-c") == 0)
+            per_core = 1;
+        else if (argv[i][0] == '-' || in != stdin)
+            usage();
+        else if ((in = fopen(argv[i], "r")) == NULL)
+        {
+            perror(argv[i]);
+            return 1;
+        }
+    }
+    coremark_result_csv_header(stdout, per_core);
+    while (fgets(line, sizeof(line), in))
+    {
+        if (!coremark_result_parse(line, &r))
+            continue;
+        coremark_result_csv(stdout, &r, per_core);
+        records++;
+    }
+    if (in != stdin)
+        fclose(in);
+    if (records == 0)
+    {
+        fprintf(stderr, "no run records found\n");
+        return 1;
+    }
+    return 0;
+}
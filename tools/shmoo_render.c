@@ -0,0 +1,339 @@
+/**
+ * @file      shmoo_render.c
+ *
+ * @brief Host tool drawing the shmoo grids of a console log
+ */
+
+/* Topic : Description
+        Reads the "shmoo," lines that <core_shmoo_run> prints, from a file or
+   standard input, skipping everything else in the log, and draws one grid
+   per chip: voltage down the side, highest first, clock along the bottom.
+
+        shmoo_render [-s] [log]
+
+        Without -s the grids are drawn as text, one character per point:
+   + pass, L list, M matrix, S state, H hang, C clock that cannot be made.
+   With -s they are written as a single SVG, coloured by result, where each
+   point carries its CoreMark/MHz and temperature as a tooltip. Logs of
+   several chips can be concatenated to compare them.
+*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_POINTS 8192
+#define MAX_CHIPS  64
+#define MAX_AXIS   128
+
+typedef struct SHMOO_POINT_S
+{
+    int    chip;
+    long   mv;
+    long   mhz;
+    char   result[16];
+    double score;
+    double temp; /* NaN when the board has no sensor */
+} shmoo_point;
+
+typedef struct SHMOO_GRID_S
+{
+    long mv[MAX_AXIS];
+    int  rows;
+    long mhz[MAX_AXIS];
+    int  cols;
+} shmoo_grid;
+
+static shmoo_point points[MAX_POINTS];
+static int         num_points;
+static char        chips[MAX_CHIPS][64];
+static int         num_chips;
+
+static const struct
+{
+    const char *result;
+    char        mark;
+    const char *colour;
+} result_style[] = {
+    { "pass", '+', "#4caf50" }, { "list", 'L', "#ffc107" },
+    { "matrix", 'M', "#ff9800" }, { "state", 'S', "#ff5722" },
+    { "hang", 'H', "#b71c1c" },  { "clock", 'C', "#bdbdbd" },
+};
+#define NUM_STYLES (int)(sizeof(result_style) / sizeof(result_style[0]))
+
+/* Function : style_of
+        Returns:
+        Index of the style of <result>, or -1 when it is not known.
+*/
+static int
+style_of(const char *result)
+{
+    int i;
+
+    for (i = 0; i < NUM_STYLES; i++)
+        if (strcmp(result_style[i].result, result) == 0)
+            return i;
+    return -1;
+}
+
+/* Function : chip_index
+        Returns:
+        Index of <chip>, added if it was not seen before, or -1 when there
+        are too many.
+*/
+static int
+chip_index(const char *chip)
+{
+    int i;
+
+    for (i = 0; i < num_chips; i++)
+        if (strcmp(chips[i], chip) == 0)
+            return i;
+    if (num_chips == MAX_CHIPS)
+        return -1;
+    strncpy(chips[num_chips], chip, sizeof(chips[0]) - 1);
+    return num_chips++;
+}
+
+/* Function : parse_line
+        Add the point on <line> if it is a shmoo line, later lines for the
+   same chip and point replacing earlier ones.
+*/
+static void
+parse_line(char *line)
+{
+    char        chip[64], result[16];
+    shmoo_point p;
+    int         i;
+
+    p.temp = NAN;
+    if (strncmp(line, "shmoo,", 6) != 0 || strncmp(line, "shmoo,chip,", 11) == 0)
+        return;
+    if (sscanf(line + 6,
+               "%63[^,],%ld,%ld,%15[^,],%lf,%lf",
+               chip,
+               &p.mv,
+               &p.mhz,
+               result,
+               &p.score,
+               &p.temp)
+        < 5)
+        return;
+    p.chip = chip_index(chip);
+    if (p.chip < 0)
+        return;
+    strcpy(p.result, result);
+    for (i = 0; i < num_points; i++)
+        if (points[i].chip == p.chip && points[i].mv == p.mv
+            && points[i].mhz == p.mhz)
+            break;
+    if (i == MAX_POINTS)
+        return;
+    points[i] = p;
+    if (i == num_points)
+        num_points++;
+}
+
+static void
+axis_add(long *axis, int *count, long value)
+{
+    int i;
+
+    for (i = 0; i < *count; i++)
+        if (axis[i] == value)
+            return;
+    if (*count < MAX_AXIS)
+        axis[(*count)++] = value;
+}
+
+static int
+cmp_desc(const void *a, const void *b)
+{
+    long x = *(const long *)a, y = *(const long *)b;
+    return (x < y) - (x > y);
+}
+
+static int
+cmp_asc(const void *a, const void *b)
+{
+    return -cmp_desc(a, b);
+}
+
+/* Function : build_grid
+        Collect the voltages and clocks <chip> was run at.
+*/
+static void
+build_grid(shmoo_grid *g, int chip)
+{
+    int i;
+
+    g->rows = g->cols = 0;
+    for (i = 0; i < num_points; i++)
+    {
+        if (points[i].chip != chip)
+            continue;
+        axis_add(g->mv, &g->rows, points[i].mv);
+        axis_add(g->mhz, &g->cols, points[i].mhz);
+    }
+    qsort(g->mv, g->rows, sizeof(long), cmp_desc);
+    qsort(g->mhz, g->cols, sizeof(long), cmp_asc);
+}
+
+static const shmoo_point *
+find_point(int chip, long mv, long mhz)
+{
+    int i;
+
+    for (i = 0; i < num_points; i++)
+        if (points[i].chip == chip && points[i].mv == mv && points[i].mhz == mhz)
+            return &points[i];
+    return NULL;
+}
+
+/* Function : render_text
+        Draw every chip as a grid of characters.
+*/
+static void
+render_text(void)
+{
+    const shmoo_point *p;
+    shmoo_grid         g;
+    int                chip, r, c, s;
+
+    for (chip = 0; chip < num_chips; chip++)
+    {
+        build_grid(&g, chip);
+        printf("chip %s\n", chips[chip]);
+        for (r = 0; r < g.rows; r++)
+        {
+            printf("%5ld mV |", g.mv[r]);
+            for (c = 0; c < g.cols; c++)
+            {
+                p = find_point(chip, g.mv[r], g.mhz[c]);
+                s = p ? style_of(p->result) : -1;
+                printf(" %c  ", p == NULL ? ' ' : s < 0 ? '?' : result_style[s].mark);
+            }
+            printf("\n");
+        }
+        printf("         +");
+        for (c = 0; c < g.cols; c++)
+            printf("----");
+        printf("\n     MHz  ");
+        for (c = 0; c < g.cols; c++)
+            printf("%-4ld", g.mhz[c]);
+        printf("\n\n");
+    }
+    printf("+ pass  L list  M matrix  S state  H hang  C clock\n");
+}
+
+#define CELL_W 36
+#define CELL_H 22
+#define LEFT   70
+#define TITLE  24
+#define BOTTOM 30
+
+/* Function : render_svg
+        Draw every chip as a coloured grid, one under the other.
+*/
+static void
+render_svg(void)
+{
+    const shmoo_point *p;
+    shmoo_grid         g;
+    int                chip, r, c, s, width = 0, height = 0, y = 0;
+    char               temp[24];
+
+    for (chip = 0; chip < num_chips; chip++)
+    {
+        build_grid(&g, chip);
+        if (LEFT + g.cols * CELL_W + 10 > width)
+            width = LEFT + g.cols * CELL_W + 10;
+        height += TITLE + g.rows * CELL_H + BOTTOM;
+    }
+    printf("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" "
+           "font-family=\"monospace\" font-size=\"11\">\n",
+           width,
+           height);
+    for (chip = 0; chip < num_chips; chip++)
+    {
+        build_grid(&g, chip);
+        printf("<text x=\"4\" y=\"%d\" font-weight=\"bold\">%s</text>\n", y + 16, chips[chip]);
+        y += TITLE;
+        for (r = 0; r < g.rows; r++)
+        {
+            printf("<text x=\"4\" y=\"%d\">%ld mV</text>\n", y + r * CELL_H + 15, g.mv[r]);
+            for (c = 0; c < g.cols; c++)
+            {
+                p = find_point(chip, g.mv[r], g.mhz[c]);
+                if (p == NULL)
+                    continue;
+                s = style_of(p->result);
+                temp[0] = 0;
+                if (p->temp == p->temp)
+                    snprintf(temp, sizeof temp, ", %.1f C", p->temp);
+                printf("<rect x=\"%d\" y=\"%d\" width=\"%d\" height=\"%d\" fill=\"%s\" stroke=\"#fff\">"
+                       "<title>%ld mV %ld MHz: %s, %.2f CoreMark/MHz%s</title></rect>\n",
+                       LEFT + c * CELL_W,
+                       y + r * CELL_H,
+                       CELL_W,
+                       CELL_H,
+                       s < 0 ? "#9c27b0" : result_style[s].colour,
+                       p->mv,
+                       p->mhz,
+                       p->result,
+                       p->score,
+                       temp);
+            }
+        }
+        y += g.rows * CELL_H;
+        for (c = 0; c < g.cols; c++)
+            printf("<text x=\"%d\" y=\"%d\" text-anchor=\"middle\">%ld</text>\n",
+                   LEFT + c * CELL_W + CELL_W / 2,
+                   y + 14,
+                   g.mhz[c]);
+        y += BOTTOM;
+    }
+    printf("</svg>\n");
+}
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: shmoo_render [-s] [log]\n");
+    exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+    char  line[512];
+    FILE *in  = stdin;
+    int   svg = 0, i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+            svg = 1;
+        else if (argv[i][0] == '-' || in != stdin)
+            usage();
+        else if ((in = fopen(argv[i], "r")) == NULL)
+        {
+            perror(argv[i]);
+            return 1;
+        }
+    }
+    while (fgets(line, sizeof(line), in))
+        parse_line(line);
+    if (in != stdin)
+        fclose(in);
+    if (num_points == 0)
+    {
+        fprintf(stderr, "no shmoo lines found\n");
+        return 1;
+    }
+    if (svg)
+        render_svg();
+    else
+        render_text();
+    return 0;
+}
@@ -0,0 +1,495 @@
+/**
+ * @file      telemetry_decode.c
+ *
+ * @brief Host tool decoding the binary telemetry of a console stream
+ */
+
+/* Topic : Description
+        Reads a console stream holding the frames of <core_telemetry.h>, from
+   a file, standard input, a serial port, or a command it runs on a pseudo
+   terminal of its own, and writes the frames as CSV.
+
+        telemetry_decode [-e command] [-n N] [-o prefix] [-x text] [source]
+
+        -e runs <command> through the shell with its standard input and
+   output on a new pty in raw mode, as a board on a USB serial port would
+   be, and decodes what it writes until it exits, so the host build can
+   stand in for a device: telemetry_decode -e "coremark -b". A source that
+   is a terminal is put into raw mode too, at the speed it is already set
+   to. -n flips a bit of every Nth byte read, to see how line noise is
+   handled.
+
+        Without -o every row goes to standard output, tagged with its frame
+   type, and each type's column names are printed once as a comment. With
+   -o the rows of each type go to <prefix>_<type>.csv with a header. Lost
+   frames show as gap rows, the sequence number of the first frame missing
+   and how many; a frame that turns up later is still written. The text
+   between the frames goes to the file given by -x. A summary goes to
+   standard error.
+*/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define MAX_FRAME   512  /* Longer runs between zero bytes are text */
+#define MAX_MISSING 1024 /* Lost sequence numbers kept for late frames */
+#define RESTART_GAP 256  /* A sequence number further back is a reboot */
+#define NO_TEMP     0x8000 /* TELEMETRY_NO_TEMP, a window without a sensor */
+
+enum FRAME_TYPE
+{
+    T_GAP = 0,
+    T_WINDOW,
+    T_TEMP,
+    T_ERROR,
+    T_CRASH,
+    T_RESULT,
+    NUM_TYPES
+};
+
+static const struct
+{
+    const char *name;
+    const char *columns;
+    unsigned    payload; /* Bytes */
+} frame_types[NUM_TYPES] = {
+    { "gap", "first,count", 0 },
+    { "window", "seq,window,iterations,secs,score,errors,temp_c", 18 },
+    { "temp", "seq,secs,temp_c,iterations", 10 },
+    { "error", "seq,context,kernel,iteration,got,expected", 10 },
+    { "crash", "seq,cause,core,pc,lr,cfsr,hfsr,iteration0,iteration1,mhz,vsel,temp_c", 44 },
+    { "result", "seq,score,contexts,iterations,errors", 14 },
+};
+
+static const char *kernel_names[] = { "list", "matrix", "state", "final" };
+static const char *cause_names[]  = { "none", "fault", "hang" };
+
+static FILE *outs[NUM_TYPES];
+static int   header_done[NUM_TYPES];
+static int   tagged = 1;
+static FILE *text_out;
+
+static struct
+{
+    unsigned long frames, bad, unknown, text, lost, late, duplicate, restarts;
+} stats;
+
+static struct
+{
+    int            started;
+    unsigned       next;
+    unsigned short missing[MAX_MISSING];
+    unsigned       num_missing;
+} seq;
+
+/* Same CRC16 as <crcu8> in core_util.c */
+static unsigned
+crcu8(unsigned char data, unsigned crc)
+{
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        if ((data ^ crc) & 1)
+            crc = ((crc ^ 0x4002) >> 1) | 0x8000;
+        else
+            crc >>= 1;
+        data >>= 1;
+    }
+    return crc & 0xffff;
+}
+
+static unsigned long
+get_u16(const unsigned char *p)
+{
+    return p[0] | (unsigned long)p[1] << 8;
+}
+
+static unsigned long
+get_u32(const unsigned char *p)
+{
+    return get_u16(p) | get_u16(p + 2) << 16;
+}
+
+static FILE *
+row(int type)
+{
+    FILE *out = outs[type] ? outs[type] : stdout;
+
+    if (!header_done[type])
+    {
+        if (tagged)
+            fprintf(out, "# %s,%s\n", frame_types[type].name, frame_types[type].columns);
+        else
+            fprintf(out, "%s\n", frame_types[type].columns);
+        header_done[type] = 1;
+    }
+    if (tagged)
+        fprintf(out, "%s,", frame_types[type].name);
+    return out;
+}
+
+/* Function : cobs_decode
+        Returns:
+        Bytes decoded from the <len> bytes of <in> into <out>, or -1 when
+        they are not valid COBS.
+*/
+static int
+cobs_decode(const unsigned char *in, int len, unsigned char *out)
+{
+    int i = 0, o = 0, code, j;
+
+    while (i < len)
+    {
+        code = in[i++];
+        if (code == 0 || i + code - 1 > len)
+            return -1;
+        for (j = 1; j < code; j++)
+            out[o++] = in[i++];
+        if (code < 0xff && i < len)
+            out[o++] = 0;
+    }
+    return o;
+}
+
+static int
+missing_take(unsigned s)
+{
+    unsigned i;
+
+    for (i = 0; i < seq.num_missing; i++)
+        if (seq.missing[i] == s)
+        {
+            seq.missing[i] = seq.missing[--seq.num_missing];
+            return 1;
+        }
+    return 0;
+}
+
+/* Function : track
+        Account for the sequence number <s> of a good frame.
+
+        Returns:
+        0 when it is a duplicate to drop, else 1.
+*/
+static int
+track(unsigned s)
+{
+    unsigned ahead = (s - seq.next) & 0xffff, i;
+
+    if (!seq.started)
+    {
+        seq.started = 1;
+        seq.next    = (s + 1) & 0xffff;
+        return 1;
+    }
+    if (ahead == 0)
+    {
+        seq.next = (s + 1) & 0xffff;
+        return 1;
+    }
+    if (ahead < 0x8000)
+    {
+        fprintf(row(T_GAP), "%u,%u\n", seq.next, ahead);
+        stats.lost += ahead;
+        for (i = 0; i < ahead; i++)
+        {
+            if (seq.num_missing == MAX_MISSING)
+                memmove(seq.missing, seq.missing + 1, --seq.num_missing * sizeof(seq.missing[0]));
+            seq.missing[seq.num_missing++] = (unsigned short)(seq.next + i);
+        }
+        seq.next = (s + 1) & 0xffff;
+        return 1;
+    }
+    if (missing_take(s))
+    {
+        stats.lost--;
+        stats.late++;
+        return 1;
+    }
+    if (0x10000 - ahead > RESTART_GAP)
+    {
+        /* the device started again from 0 */
+        stats.restarts++;
+        seq.num_missing = 0;
+        seq.next        = (s + 1) & 0xffff;
+        return 1;
+    }
+    stats.duplicate++;
+    return 0;
+}
+
+static void
+frame(const unsigned char *raw, int len)
+{
+    const unsigned char *p    = raw + 3;
+    int                  type = raw[0];
+    unsigned             s    = (unsigned)get_u16(raw + 1);
+    FILE                *out;
+    double               secs;
+
+    if (type <= T_GAP || type >= NUM_TYPES || (unsigned)len - 5 != frame_types[type].payload)
+    {
+        stats.unknown++;
+        track(s);
+        return;
+    }
+    if (!track(s))
+        return;
+    stats.frames++;
+    out = row(type);
+    switch (type)
+    {
+    case T_WINDOW:
+        secs = get_u32(p + 8) / 1e6;
+        fprintf(out, "%u,%lu,%lu,%.6f,%.3f,%lu,", s, get_u32(p), get_u32(p + 4), secs,
+                secs > 0 ? get_u32(p + 4) / secs : 0, get_u32(p + 12));
+        if (get_u16(p + 16) == NO_TEMP)
+            fprintf(out, "\n");
+        else
+            fprintf(out, "%.1f\n", (short)get_u16(p + 16) / 10.0);
+        break;
+    case T_TEMP:
+        fprintf(out, "%u,%.3f,%.1f,%lu\n", s, get_u32(p) / 1e3, (short)get_u16(p + 4) / 10.0,
+                get_u32(p + 6));
+        break;
+    case T_ERROR:
+        fprintf(out, "%u,%u,%s,", s, p[0], p[1] < 4 ? kernel_names[p[1]] : "?");
+        if (get_u32(p + 2) == 0xffffffff)
+            fprintf(out, ",");
+        else
+            fprintf(out, "%lu,", get_u32(p + 2));
+        fprintf(out, "0x%04lx,0x%04lx\n", get_u16(p + 6), get_u16(p + 8));
+        break;
+    case T_CRASH:
+        fprintf(out, "%u,%s,%lu,0x%08lx,0x%08lx,0x%08lx,0x%08lx,", s,
+                get_u32(p) < 3 ? cause_names[get_u32(p)] : "?", get_u32(p + 4), get_u32(p + 8),
+                get_u32(p + 12), get_u32(p + 16), get_u32(p + 20));
+        fprintf(out, "%ld,%ld,%lu,%lu,%.1f\n", (long)(int)get_u32(p + 24),
+                (long)(int)get_u32(p + 28), get_u32(p + 32), get_u32(p + 36),
+                (int)get_u32(p + 40) / 10.0);
+        break;
+    case T_RESULT:
+        fprintf(out, "%u,%.3f,%lu,%lu,%d\n", s, get_u32(p) / 1e3, get_u32(p + 4), get_u32(p + 8),
+                (short)get_u16(p + 12));
+        break;
+    }
+}
+
+static int
+is_text(const unsigned char *p, int len)
+{
+    int i;
+
+    for (i = 0; i < len; i++)
+        if ((p[i] < 0x20 && p[i] != '\n' && p[i] != '\r' && p[i] != '\t') || p[i] > 0x7e)
+            return 0;
+    return 1;
+}
+
+/* Function : chunk
+        Handle the <len> bytes between two zero bytes.
+*/
+static void
+chunk(const unsigned char *p, int len)
+{
+    unsigned char raw[MAX_FRAME];
+    unsigned      crc = 0;
+    int           n, i;
+
+    if (len == 0)
+        return;
+    if (is_text(p, len))
+    {
+        stats.text += len;
+        if (text_out)
+            fwrite(p, 1, len, text_out);
+        return;
+    }
+    n = cobs_decode(p, len, raw);
+    if (n < 5)
+    {
+        stats.bad++;
+        return;
+    }
+    for (i = 0; i < n - 2; i++)
+        crc = crcu8(raw[i], crc);
+    if (crc != get_u16(raw + n - 2))
+    {
+        stats.bad++;
+        return;
+    }
+    frame(raw, n);
+}
+
+static void
+raw_mode(int fd)
+{
+    struct termios t;
+
+    if (tcgetattr(fd, &t) == 0)
+    {
+        cfmakeraw(&t);
+        tcsetattr(fd, TCSANOW, &t);
+    }
+}
+
+/* Function : spawn
+        Run <command> with its standard input and output on a new pty.
+
+        Returns:
+        The master side to read, or -1.
+*/
+static int
+spawn(const char *command, pid_t *pid)
+{
+    int         master = posix_openpt(O_RDWR | O_NOCTTY), slave;
+    const char *name;
+
+    if (master < 0 || grantpt(master) || unlockpt(master) || (name = ptsname(master)) == NULL)
+    {
+        perror("pty");
+        return -1;
+    }
+    if ((*pid = fork()) < 0)
+    {
+        perror("fork");
+        return -1;
+    }
+    if (*pid == 0)
+    {
+        setsid();
+        if ((slave = open(name, O_RDWR)) < 0)
+            _exit(127);
+        raw_mode(slave);
+        dup2(slave, 0);
+        dup2(slave, 1);
+        close(slave);
+        close(master);
+        execl("/bin/sh", "sh", "-c", command, (char *)NULL);
+        _exit(127);
+    }
+    return master;
+}
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: telemetry_decode [-e command] [-n N] [-o prefix] [-x text] [source]\n");
+    exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+    static unsigned char buf[4096], pending[MAX_FRAME];
+    const char          *command = NULL, *prefix = NULL, *source = NULL;
+    unsigned long        noise = 0, count = 0;
+    int                  fd = 0, len = 0, n, i, status = 0;
+    pid_t                pid = 0;
+    char                 path[4096];
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            command = argv[++i];
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            noise = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            prefix = argv[++i];
+        else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc)
+        {
+            if ((text_out = fopen(argv[++i], "wb")) == NULL)
+            {
+                perror(argv[i]);
+                return 1;
+            }
+        }
+        else if (argv[i][0] == '-' || source || command)
+            usage();
+        else
+            source = argv[i];
+    }
+    if (command && source)
+        usage();
+
+    if (prefix)
+    {
+        tagged = 0;
+        for (i = 0; i < NUM_TYPES; i++)
+        {
+            snprintf(path, sizeof(path), "%s_%s.csv", prefix, frame_types[i].name);
+            if ((outs[i] = fopen(path, "w")) == NULL)
+            {
+                perror(path);
+                return 1;
+            }
+            fprintf(outs[i], "%s\n", frame_types[i].columns);
+            header_done[i] = 1;
+        }
+    }
+    if (command)
+        fd = spawn(command, &pid);
+    else if (source && strcmp(source, "-") != 0)
+        fd = open(source, O_RDONLY | O_NOCTTY);
+    if (fd < 0)
+    {
+        if (source)
+            perror(source);
+        return 1;
+    }
+    if (!command && isatty(fd))
+        raw_mode(fd);
+
+    for (;;)
+    {
+        n = (int)read(fd, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR)
+            continue;
+        /* a pty reads EIO once the command has exited */
+        if (n <= 0)
+            break;
+        for (i = 0; i < n; i++)
+        {
+            if (noise && ++count % noise == 0)
+                buf[i] ^= 1 << (count / noise % 8);
+            if (buf[i] == 0)
+            {
+                chunk(pending, len);
+                len = 0;
+            }
+            else if (len == MAX_FRAME)
+            {
+                /* no frame is this long, so it is text or noise */
+                chunk(pending, len);
+                pending[0] = buf[i];
+                len        = 1;
+            }
+            else
+                pending[len++] = buf[i];
+        }
+    }
+    chunk(pending, len);
+    if (pid > 0)
+        waitpid(pid, &status, 0);
+
+    fprintf(stderr,
+            "frames %lu, bad %lu, unknown %lu, text %lu bytes, lost %lu, late %lu, "
+            "duplicate %lu, restarts %lu\n",
+            stats.frames, stats.bad, stats.unknown, stats.text, stats.lost, stats.late,
+            stats.duplicate, stats.restarts);
+    for (i = 0; i < NUM_TYPES; i++)
+        if (outs[i])
+            fclose(outs[i]);
+    if (text_out)
+        fclose(text_out);
+    if (pid > 0 && !(WIFEXITED(status) && WEXITSTATUS(status) == 0))
+        return 1;
+    return stats.frames ? 0 : 1;
+}